@@ -43,6 +43,64 @@ void ConnectionQueueBM_getUntil(benchmark::State& state) {
   }
 }
 
+/**
+ * Pool of connections spread over many endpoints, checked out by endpoint
+ * the way single hop routes operations to a specific server.
+ */
+class EndpointTestObject : public TestObject {
+ public:
+  explicit EndpointTestObject(int64_t endpoint) : endpoint_(endpoint) {}
+  int64_t endpoint() const { return endpoint_; }
+
+ private:
+  int64_t endpoint_;
+};
+
+class EndpointConnectionQueue
+    : public apache::geode::client::ConnectionQueue<EndpointTestObject,
+                                                    std::recursive_mutex> {
+ public:
+  EndpointTestObject* getFromEP(int64_t endpoint) {
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+    return popNoLock(toEndpoint(endpoint));
+  }
+
+ protected:
+  const void* partitionOf(const EndpointTestObject* object) const override {
+    return toEndpoint(object->endpoint());
+  }
+
+ private:
+  static const void* toEndpoint(int64_t endpoint) {
+    return reinterpret_cast<const void*>(static_cast<intptr_t>(endpoint + 1));
+  }
+};
+
+const auto ENDPOINTS = 32;
+
+void ConnectionQueueBM_getFromEP(benchmark::State& state) {
+  static EndpointConnectionQueue queue;
+  if (state.thread_index == 0) {
+    for (int64_t i = 0; i < state.range(0) * ENDPOINTS; ++i) {
+      queue.put(new EndpointTestObject(i % ENDPOINTS), true);
+    }
+  }
+
+  auto endpoint = static_cast<int64_t>(state.thread_index) % ENDPOINTS;
+  for (auto _ : state) {
+    auto v = queue.getFromEP(endpoint);
+    if (v) {
+      queue.put(v, true);
+    }
+    endpoint = (endpoint + 1) % ENDPOINTS;
+  }
+
+  if (state.thread_index == 0) {
+    queue.close();
+    queue.reset();
+  }
+}
+
 const auto MAX_THREADS = std::thread::hardware_concurrency() * 8;
 
 BENCHMARK_TEMPLATE(ConnectionQueueBM_getUntil,
@@ -57,3 +115,8 @@ BENCHMARK_TEMPLATE(
     ->Range(1, MAX_THREADS * 2)
     ->ThreadRange(1, MAX_THREADS)
     ->UseRealTime();
+
+BENCHMARK(ConnectionQueueBM_getFromEP)
+    ->Range(1, 64)
+    ->ThreadRange(1, MAX_THREADS)
+    ->UseRealTime();
@@ -0,0 +1,92 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "util/JavaModifiedUtf8.hpp"
+#include "util/string.hpp"
+
+using apache::geode::client::to_utf16;
+using apache::geode::client::to_utf8;
+using apache::geode::client::internal::JavaModifiedUtf8;
+
+template <class ToString>
+ToString convert(const std::u32string& from);
+
+template <>
+std::string convert(const std::u32string& from) {
+  return to_utf8(from);
+}
+
+template <>
+std::u16string convert(const std::u32string& from) {
+  return to_utf16(from);
+}
+
+template <>
+std::u32string convert(const std::u32string& from) {
+  return from;
+}
+
+template <class String, char32_t UnicodeChar>
+void JavaModifiedUtf8BM_encode(benchmark::State& state) {
+  const std::u32string u32String(state.range(0), UnicodeChar);
+  const String string = convert<String>(u32String);
+  std::string jmutf8(
+      JavaModifiedUtf8::encodedLength(string.data(), string.length()), '\0');
+
+  for (auto _ : state) {
+    size_t length;
+    benchmark::DoNotOptimize(
+        length = JavaModifiedUtf8::encode(string.data(), string.length(),
+                                          &jmutf8[0], jmutf8.length()));
+  }
+  state.SetBytesProcessed(state.iterations() * jmutf8.length());
+}
+
+template <class String, char32_t UnicodeChar>
+void JavaModifiedUtf8BM_decode(benchmark::State& state) {
+  const std::u32string u32String(state.range(0), UnicodeChar);
+  const auto jmutf8 = JavaModifiedUtf8::fromString(to_utf16(u32String));
+  String string;
+
+  for (auto _ : state) {
+    JavaModifiedUtf8::decode(jmutf8.data(), jmutf8.length(), string);
+    benchmark::DoNotOptimize(string.data());
+  }
+  state.SetBytesProcessed(state.iterations() * jmutf8.length());
+}
+
+constexpr char32_t LATIN_CAPITAL_LETTER_C = U'\U00000043';
+constexpr char32_t INVERTED_EXCLAMATION_MARK = U'\U000000A1';
+constexpr char32_t LINEAR_B_SYLLABLE_B008_A = U'\U00010000';
+
+#define JAVA_MODIFIED_UTF8_BM(STRING, CHAR)                   \
+  BENCHMARK_TEMPLATE(JavaModifiedUtf8BM_encode, STRING, CHAR) \
+      ->Range(8, 8 << 10);                                    \
+  BENCHMARK_TEMPLATE(JavaModifiedUtf8BM_decode, STRING, CHAR) \
+      ->Range(8, 8 << 10)
+
+JAVA_MODIFIED_UTF8_BM(std::string, LATIN_CAPITAL_LETTER_C);
+JAVA_MODIFIED_UTF8_BM(std::u16string, LATIN_CAPITAL_LETTER_C);
+JAVA_MODIFIED_UTF8_BM(std::u32string, LATIN_CAPITAL_LETTER_C);
+JAVA_MODIFIED_UTF8_BM(std::string, INVERTED_EXCLAMATION_MARK);
+JAVA_MODIFIED_UTF8_BM(std::u16string, INVERTED_EXCLAMATION_MARK);
+JAVA_MODIFIED_UTF8_BM(std::u32string, INVERTED_EXCLAMATION_MARK);
+JAVA_MODIFIED_UTF8_BM(std::string, LINEAR_B_SYLLABLE_B008_A);
+JAVA_MODIFIED_UTF8_BM(std::u16string, LINEAR_B_SYLLABLE_B008_A);
+JAVA_MODIFIED_UTF8_BM(std::u32string, LINEAR_B_SYLLABLE_B008_A);
@@ -0,0 +1,61 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <geode/Cache.hpp>
+#include <geode/CacheFactory.hpp>
+#include <geode/CacheableBuiltins.hpp>
+#include <geode/Region.hpp>
+#include <geode/RegionFactory.hpp>
+#include <geode/RegionShortcut.hpp>
+
+using apache::geode::client::Cache;
+using apache::geode::client::CacheableInt32;
+using apache::geode::client::CacheFactory;
+using apache::geode::client::Region;
+using apache::geode::client::RegionShortcut;
+
+/**
+ * Threads reading entries of their own from one local region, so that the
+ * only state they share is the region itself.
+ */
+static void LocalRegionBM_get(benchmark::State& state) {
+  static Cache* cache;
+  static std::shared_ptr<Region> region;
+  if (state.thread_index == 0) {
+    cache = new Cache(CacheFactory().set("log-level", "none").create());
+    region = cache->createRegionFactory(RegionShortcut::LOCAL).create("region");
+    for (int32_t i = 0; i < state.threads; i++) {
+      region->put(CacheableInt32::create(i), CacheableInt32::create(i));
+    }
+  }
+
+  auto key = CacheableInt32::create(state.thread_index);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(region->get(key));
+  }
+  state.SetItemsProcessed(state.iterations());
+
+  if (state.thread_index == 0) {
+    region = nullptr;
+    cache->close();
+    delete cache;
+  }
+}
+
+BENCHMARK(LocalRegionBM_get)->ThreadRange(1, 64)->UseRealTime();
@@ -0,0 +1,174 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <geode/Cache.hpp>
+#include <geode/CacheFactory.hpp>
+
+#include "CacheImpl.hpp"
+#include "CacheRegionHelper.hpp"
+#include "PdxInstanceImpl.hpp"
+#include "PdxTypes.hpp"
+
+using apache::geode::client::Cache;
+using apache::geode::client::CacheableInt32;
+using apache::geode::client::CacheableString;
+using apache::geode::client::CacheFactory;
+using apache::geode::client::CacheImpl;
+using apache::geode::client::CacheRegionHelper;
+using apache::geode::client::FieldVsValues;
+using apache::geode::client::PdxFieldTypes;
+using apache::geode::client::PdxInstanceImpl;
+using apache::geode::client::PdxLocalWriter;
+using apache::geode::client::PdxType;
+using apache::geode::client::PdxTypes;
+
+/**
+ * Builds a PdxInstanceImpl the way it would be read from a server: a
+ * registered type and a serialized byte stream. Int and string fields are
+ * interleaved so that most field positions come from the offset table.
+ */
+class PdxInstanceBMFixture {
+ public:
+  explicit PdxInstanceBMFixture(int64_t numberOfFields)
+      : cache_(CacheFactory().set("log-level", "none").create()),
+        cacheImpl_(CacheRegionHelper::getCacheImpl(&cache_)) {
+    auto pdxTypeRegistry = cacheImpl_->getPdxTypeRegistry();
+    auto pdxType =
+        std::make_shared<PdxType>(*pdxTypeRegistry, "PdxInstanceBM", false);
+
+    FieldVsValues values;
+    for (int64_t i = 0; i < numberOfFields; i += 2) {
+      auto intField = "int" + std::to_string(i);
+      pdxType->addFixedLengthTypeField(intField, "int", PdxFieldTypes::INT,
+                                       PdxTypes::INTEGER_SIZE);
+      values.emplace(intField, CacheableInt32::create(static_cast<int>(i)));
+
+      auto stringField = "string" + std::to_string(i + 1);
+      pdxType->addVariableLengthTypeField(stringField, "string",
+                                          PdxFieldTypes::STRING);
+      values.emplace(stringField, CacheableString::create(stringField));
+    }
+    lastIntField_ = "int" + std::to_string(numberOfFields - 2);
+    lastStringField_ = "string" + std::to_string(numberOfFields - 1);
+
+    pdxType->setTypeId(1);
+    pdxTypeRegistry->addPdxType(1, pdxType);
+
+    PdxInstanceImpl writer(values, pdxType, cacheImpl_->getCachePerfStats(),
+                           *pdxTypeRegistry, *cacheImpl_, false);
+    auto output = cacheImpl_->createDataOutput();
+    PdxLocalWriter localWriter(output, pdxType, pdxTypeRegistry);
+    writer.toData(localWriter);
+    localWriter.endObjectWriting();
+    int length = 0;
+    auto pdxStream = localWriter.getPdxStream(length);
+    pdxStream_.assign(pdxStream, pdxStream + length);
+    delete[] pdxStream;
+  }
+
+  ~PdxInstanceBMFixture() { cache_.close(); }
+
+  std::shared_ptr<PdxInstanceImpl> createInstance() {
+    return std::make_shared<PdxInstanceImpl>(
+        pdxStream_.data(), pdxStream_.size(), 1,
+        cacheImpl_->getCachePerfStats(), *cacheImpl_->getPdxTypeRegistry(),
+        *cacheImpl_, false);
+  }
+
+  CacheImpl& cacheImpl() { return *cacheImpl_; }
+
+  const std::string& lastIntField() const { return lastIntField_; }
+
+  const std::string& lastStringField() const { return lastStringField_; }
+
+ private:
+  Cache cache_;
+  CacheImpl* cacheImpl_;
+  std::vector<uint8_t> pdxStream_;
+  std::string lastIntField_;
+  std::string lastStringField_;
+};
+
+static void PdxInstanceBM_getIntField(benchmark::State& state) {
+  PdxInstanceBMFixture fixture(state.range(0));
+  auto pdxInstance = fixture.createInstance();
+  for (auto _ : state) {
+    int32_t value;
+    benchmark::DoNotOptimize(
+        value = pdxInstance->getIntField(fixture.lastIntField()));
+  }
+}
+
+static void PdxInstanceBM_getStringField(benchmark::State& state) {
+  PdxInstanceBMFixture fixture(state.range(0));
+  auto pdxInstance = fixture.createInstance();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        pdxInstance->getStringField(fixture.lastStringField()));
+  }
+}
+
+static void PdxInstanceBM_hashcode(benchmark::State& state) {
+  PdxInstanceBMFixture fixture(state.range(0));
+  auto pdxInstance = fixture.createInstance();
+  for (auto _ : state) {
+    int32_t hashcode;
+    benchmark::DoNotOptimize(hashcode = pdxInstance->hashcode());
+  }
+}
+
+static void PdxInstanceBM_equals(benchmark::State& state) {
+  PdxInstanceBMFixture fixture(state.range(0));
+  auto pdxInstance = fixture.createInstance();
+  auto otherPdxInstance = fixture.createInstance();
+  for (auto _ : state) {
+    bool equals;
+    benchmark::DoNotOptimize(equals = (*pdxInstance == *otherPdxInstance));
+  }
+}
+
+static void PdxInstanceBM_serialize(benchmark::State& state) {
+  PdxInstanceBMFixture fixture(state.range(0));
+  auto pdxInstance = fixture.createInstance();
+  auto output = fixture.cacheImpl().createDataOutput();
+  for (auto _ : state) {
+    output.reset();
+    output.writeObject(pdxInstance);
+  }
+}
+
+static void PdxInstanceBM_serializeModified(benchmark::State& state) {
+  PdxInstanceBMFixture fixture(state.range(0));
+  auto pdxInstance = fixture.createInstance();
+  auto output = fixture.cacheImpl().createDataOutput();
+  int32_t value = 0;
+  for (auto _ : state) {
+    auto writer = pdxInstance->createWriter();
+    writer->setField(fixture.lastIntField(), value++);
+    output.reset();
+    output.writeObject(writer);
+  }
+}
+
+BENCHMARK(PdxInstanceBM_getIntField)->Range(2, 256);
+BENCHMARK(PdxInstanceBM_getStringField)->Range(2, 256);
+BENCHMARK(PdxInstanceBM_hashcode)->Range(2, 256);
+BENCHMARK(PdxInstanceBM_equals)->Range(2, 256);
+BENCHMARK(PdxInstanceBM_serialize)->Range(2, 256);
+BENCHMARK(PdxInstanceBM_serializeModified)->Range(2, 256);
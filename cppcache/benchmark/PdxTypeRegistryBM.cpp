@@ -0,0 +1,71 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <benchmark/benchmark.h>
+
+#include <thread>
+
+#include "PdxType.hpp"
+#include "PdxTypeRegistry.hpp"
+
+using apache::geode::client::PdxType;
+using apache::geode::client::PdxTypeRegistry;
+
+/**
+ * Registry shared by all benchmark threads, holding a realistic number of
+ * local and remote types so lookups are not trivially cheap.
+ */
+static PdxTypeRegistry& sharedPdxTypeRegistry() {
+  static PdxTypeRegistry pdxTypeRegistry(nullptr);
+  static bool initialized = [] {
+    for (int32_t typeId = 1; typeId <= 256; typeId++) {
+      auto className = "com.example.PdxTypeRegistryBM" + std::to_string(typeId);
+      auto pdxType =
+          std::make_shared<PdxType>(pdxTypeRegistry, className, true);
+      pdxType->setTypeId(typeId);
+      pdxTypeRegistry.addPdxType(typeId, pdxType);
+      pdxTypeRegistry.addLocalPdxType(className, pdxType);
+    }
+    return true;
+  }();
+  (void)initialized;
+  return pdxTypeRegistry;
+}
+
+static void PdxTypeRegistryBM_getPdxType(benchmark::State& state) {
+  auto& pdxTypeRegistry = sharedPdxTypeRegistry();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(pdxTypeRegistry.getPdxType(128));
+  }
+}
+
+static void PdxTypeRegistryBM_getLocalPdxType(benchmark::State& state) {
+  auto& pdxTypeRegistry = sharedPdxTypeRegistry();
+  const std::string className = "com.example.PdxTypeRegistryBM128";
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(pdxTypeRegistry.getLocalPdxType(className));
+  }
+}
+
+const auto MAX_THREADS = std::thread::hardware_concurrency() * 8;
+
+BENCHMARK(PdxTypeRegistryBM_getPdxType)
+    ->ThreadRange(1, MAX_THREADS)
+    ->UseRealTime();
+
+BENCHMARK(PdxTypeRegistryBM_getLocalPdxType)
+    ->ThreadRange(1, MAX_THREADS)
+    ->UseRealTime();
@@ -77,6 +77,15 @@ static void SerializationRegistryBM_findDataSerializablePrimitive(
   }
 }
 
+static void SerializationRegistryBM_createDataSerializablePrimitive(
+    benchmark::State& state) {
+  TheTypeMap theTypeMap;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        theTypeMap.createDataSerializablePrimitive(DSCode::CacheableString));
+  }
+}
+
 static void SerializationRegistryBM_findDataSerializableFixedId(
     benchmark::State& state) {
   TheTypeMap theTypeMap;
@@ -112,6 +121,10 @@ BENCHMARK(SerializationRegistryBM_findDataSerializablePrimitive)
     ->ThreadRange(1, MAX_THREADS)
     ->UseRealTime();
 
+BENCHMARK(SerializationRegistryBM_createDataSerializablePrimitive)
+    ->ThreadRange(1, MAX_THREADS)
+    ->UseRealTime();
+
 BENCHMARK(SerializationRegistryBM_findDataSerializableFixedId)
     ->ThreadRange(1, MAX_THREADS)
     ->UseRealTime();
@@ -0,0 +1,133 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#if defined(__linux__)
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "IoUring.hpp"
+#include "TcpConn.hpp"
+
+using apache::geode::client::IoUring;
+using apache::geode::client::TcpConn;
+
+/**
+ * Echoes everything received on a loopback connection back to its sender,
+ * standing in for a server that answers each request right away.
+ */
+class EchoServer {
+ public:
+  EchoServer() : listener_(::socket(AF_INET, SOCK_STREAM, 0)), port_(0) {
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    socklen_t length = sizeof(address);
+    if (::bind(listener_, reinterpret_cast<sockaddr*>(&address), length) ||
+        ::listen(listener_, 1) ||
+        ::getsockname(listener_, reinterpret_cast<sockaddr*>(&address),
+                      &length)) {
+      throw std::runtime_error("EchoServer failed to listen");
+    }
+    port_ = ntohs(address.sin_port);
+    thread_ = std::thread(&EchoServer::run, this);
+  }
+
+  ~EchoServer() {
+    // the client closing its connection ends the echo loop
+    thread_.join();
+    ::close(listener_);
+  }
+
+  std::string address() const { return "127.0.0.1:" + std::to_string(port_); }
+
+ private:
+  int listener_;
+  uint16_t port_;
+  std::thread thread_;
+
+  void run() {
+    auto connection = ::accept(listener_, nullptr, nullptr);
+    if (connection == -1) {
+      return;
+    }
+    std::vector<char> buffer(64 * 1024);
+    ssize_t received;
+    while ((received = ::recv(connection, buffer.data(), buffer.size(), 0)) >
+           0) {
+      for (ssize_t sent = 0, retVal; sent < received; sent += retVal) {
+        retVal = ::send(connection, buffer.data() + sent,
+                        static_cast<size_t>(received - sent), MSG_NOSIGNAL);
+        if (retVal <= 0) {
+          ::close(connection);
+          return;
+        }
+      }
+    }
+    ::close(connection);
+  }
+};
+
+/**
+ * Round trips of a message through TcpConn, with io_uring if the first
+ * argument is 1 or with the ACE socket calls otherwise.
+ */
+static void TcpConnBM_roundTrip(benchmark::State& state) {
+  const auto ioUring = state.range(0) == 1;
+  if (ioUring && !IoUring::isSupported()) {
+    state.SkipWithError("io_uring is not available");
+    return;
+  }
+
+  EchoServer server;
+  TcpConn conn(server.address(), std::chrono::seconds(10), 0);
+  if (ioUring) {
+    conn.enableIoUring();
+  }
+  conn.init();
+
+  const auto size = static_cast<size_t>(state.range(1));
+  std::vector<char> request(size, 'x');
+  std::vector<char> response(size);
+  for (auto _ : state) {
+    if (conn.send(request.data(), size, std::chrono::seconds(10)) != size ||
+        conn.receive(response.data(), size, std::chrono::seconds(10)) !=
+            size) {
+      state.SkipWithError("round trip failed");
+      break;
+    }
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * size));
+
+  conn.close();
+}
+
+BENCHMARK(TcpConnBM_roundTrip)
+    ->ArgNames({"io_uring", "size"})
+    ->Ranges({{0, 1}, {64, 64 << 10}});
+
+#endif  // defined(__linux__)
@@ -0,0 +1,115 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "ThreadPool.hpp"
+
+using apache::geode::client::PooledWork;
+using apache::geode::client::ThreadPool;
+
+/**
+ * Stands in for PutAllWork: copies the entries of one bucket out of the
+ * user's map, the way single hop builds the sub map of each server.
+ */
+class BucketPutAllWork : public PooledWork<size_t> {
+ public:
+  BucketPutAllWork(const std::unordered_map<int64_t, int64_t>& map,
+                   const std::vector<int64_t>& keys)
+      : map_(map), keys_(keys) {}
+
+ protected:
+  size_t execute() override {
+    std::unordered_map<int64_t, int64_t> subMap;
+    for (auto key : keys_) {
+      auto iter = map_.find(key);
+      if (iter != map_.end()) {
+        subMap.emplace(iter->first, iter->second);
+      }
+    }
+    return subMap.size();
+  }
+
+ private:
+  const std::unordered_map<int64_t, int64_t>& map_;
+  const std::vector<int64_t>& keys_;
+};
+
+/**
+ * Fans one putAll out into a work per bucket and joins them.
+ */
+static void putAllFanOut(benchmark::State& state, ThreadPool& threadPool) {
+  const int64_t buckets = state.range(0);
+  const int64_t keysPerBucket = 8;
+
+  std::unordered_map<int64_t, int64_t> map;
+  std::vector<std::vector<int64_t>> bucketKeys(buckets);
+  for (int64_t i = 0; i < buckets * keysPerBucket; i++) {
+    map.emplace(i, i);
+    bucketKeys[i % buckets].push_back(i);
+  }
+
+  std::vector<std::shared_ptr<BucketPutAllWork>> workers;
+  workers.reserve(buckets);
+  for (auto _ : state) {
+    for (const auto& keys : bucketKeys) {
+      auto worker = std::make_shared<BucketPutAllWork>(map, keys);
+      threadPool.perform(worker);
+      workers.push_back(worker);
+    }
+
+    size_t total = 0;
+    for (const auto& worker : workers) {
+      total += worker->getResult();
+    }
+    benchmark::DoNotOptimize(total);
+    workers.clear();
+  }
+  state.SetItemsProcessed(state.iterations() * buckets);
+}
+
+static void ThreadPoolBM_putAllFanOut(benchmark::State& state) {
+  ThreadPool threadPool(std::thread::hardware_concurrency() * 2);
+  putAllFanOut(state, threadPool);
+}
+
+BENCHMARK(ThreadPoolBM_putAllFanOut)->Range(8, 1024)->UseRealTime();
+
+/**
+ * Several application threads doing single hop putAll at the same time.
+ */
+static void ThreadPoolBM_concurrentPutAllFanOut(benchmark::State& state) {
+  static ThreadPool* threadPool;
+  if (state.thread_index == 0) {
+    threadPool = new ThreadPool(std::thread::hardware_concurrency() * 2);
+  }
+
+  putAllFanOut(state, *threadPool);
+
+  if (state.thread_index == 0) {
+    delete threadPool;
+  }
+}
+
+BENCHMARK(ThreadPoolBM_concurrentPutAllFanOut)
+    ->Arg(113)
+    ->ThreadRange(1, 8)
+    ->UseRealTime();
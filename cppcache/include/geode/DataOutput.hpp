@@ -560,25 +560,13 @@ class APACHE_GEODE_EXPORT DataOutput {
                           value.length());
   }
 
-  inline void writeJavaModifiedUtf8(const char16_t* data, size_t len) {
-    if (0 == len) {
-      writeInt(static_cast<uint16_t>(0));
-    } else {
-      auto encodedLen = static_cast<uint16_t>(
-          std::min<size_t>(getJavaModifiedUtf8EncodedLength(data, len),
-                           std::numeric_limits<uint16_t>::max()));
-      writeInt(encodedLen);
-      ensureCapacity(encodedLen);
-      const auto end = m_buf + encodedLen;
-      while (m_buf < end) {
-        encodeJavaModifiedUtf8(*data++);
-      }
-      if (m_buf > end) m_buf = end;
-    }
-  }
+  void writeJavaModifiedUtf8(const char16_t* data, size_t len);
 
   void writeJavaModifiedUtf8(const char32_t* data, size_t len);
 
+  template <class _CharT>
+  void writeJavaModifiedUtf8Units(const _CharT* data, size_t len);
+
   template <class _CharT, class _Traits, class _Allocator>
   inline void writeUtf16Huge(
       const std::basic_string<_CharT, _Traits, _Allocator>& value) {
@@ -702,24 +690,6 @@ class APACHE_GEODE_EXPORT DataOutput {
     }
   }
 
-  inline void encodeJavaModifiedUtf8(const char16_t c) {
-    if (c == 0) {
-      // NUL
-      *(m_buf++) = 0xc0;
-      *(m_buf++) = 0x80;
-    } else if (c < 0x80) {
-      // ASCII character
-      *(m_buf++) = static_cast<uint8_t>(c);
-    } else if (c < 0x800) {
-      *(m_buf++) = static_cast<uint8_t>(0xC0 | c >> 6);
-      *(m_buf++) = static_cast<uint8_t>(0x80 | (c & 0x3F));
-    } else {
-      *(m_buf++) = static_cast<uint8_t>(0xE0 | c >> 12);
-      *(m_buf++) = static_cast<uint8_t>(0x80 | ((c >> 6) & 0x3F));
-      *(m_buf++) = static_cast<uint8_t>(0x80 | (c & 0x3F));
-    }
-  }
-
   inline void writeNoCheck(uint8_t value) { *(m_buf++) = value; }
 
   inline void writeNoCheck(int8_t value) {
@@ -21,6 +21,7 @@
 #define GEODE_ENTRYEVENT_H_
 
 #include <memory>
+#include <mutex>
 
 #include "CacheableKey.hpp"
 #include "Region.hpp"
@@ -45,8 +46,8 @@ class APACHE_GEODE_EXPORT EntryEvent {
  protected:
   std::shared_ptr<Region> m_region;      /**< Region */
   std::shared_ptr<CacheableKey> m_key;   /**< Cacheable key */
-  std::shared_ptr<Cacheable> m_oldValue; /**< Old value */
-  std::shared_ptr<Cacheable> m_newValue; /**< New value */
+  mutable std::shared_ptr<Cacheable> m_oldValue; /**< Old value */
+  mutable std::shared_ptr<Cacheable> m_newValue; /**< New value */
   std::shared_ptr<Serializable>
       m_callbackArgument; /**< Callback argument for this event, if any. */
   bool m_remoteOrigin;    /**< True if from a remote (non-local) process */
@@ -74,15 +75,22 @@ class APACHE_GEODE_EXPORT EntryEvent {
 
   /** If the prior state of the entry was invalid, or non-existent/destroyed,
    * then the old value will be nullptr.
+   *
+   * In regions that do not store values as objects, see
+   * RegionAttributesFactory::setValueStorage, the old value is deserialized
+   * by the first call.
    * @return the old value in the cache.
    */
-  inline std::shared_ptr<Cacheable> getOldValue() const { return m_oldValue; }
+  std::shared_ptr<Cacheable> getOldValue() const;
 
   /** If the event is a destroy or invalidate operation, then the new value
    * will be nullptr.
+   *
+   * In regions that do not store values as objects, a value received from
+   * the server is deserialized by the first call.
    * @return the updated value from this event
    */
-  inline std::shared_ptr<Cacheable> getNewValue() const { return m_newValue; }
+  std::shared_ptr<Cacheable> getNewValue() const;
 
   /**
    * Returns the callbackArgument passed to the method that generated
@@ -97,6 +105,10 @@ class APACHE_GEODE_EXPORT EntryEvent {
   inline bool remoteOrigin() const { return m_remoteOrigin; }
 
  private:
+  // the values are deserialized once, by the first reader
+  mutable std::once_flag m_oldValueLoaded;
+  mutable std::once_flag m_newValueLoaded;
+
   // never implemented.
   EntryEvent(const EntryEvent& other);
   void operator=(const EntryEvent& other);
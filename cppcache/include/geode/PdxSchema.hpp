@@ -0,0 +1,293 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_PDXSCHEMA_H_
+#define GEODE_PDXSCHEMA_H_
+
+#include <string>
+#include <vector>
+
+#include "DataInput.hpp"
+#include "DataOutput.hpp"
+#include "PdxReader.hpp"
+#include "PdxSerializable.hpp"
+#include "PdxWriter.hpp"
+#include "internal/geode_base.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+namespace internal {
+
+/**
+ * Maps a C++ field type onto its PDX representation. Each specialization
+ * writes and reads the field both directly against the wire format and
+ * through the generic PdxWriter/PdxReader interfaces.
+ */
+template <class Type>
+struct PdxSchemaFieldCodec;
+
+#define _GEODE_PDX_SCHEMA_FIXED_CODEC(TYPE, WRITE, WRITER, READER) \
+  template <>                                                      \
+  struct PdxSchemaFieldCodec<TYPE> {                               \
+    static const bool variableLength = false;                      \
+    static void write(DataOutput& output, TYPE value) {            \
+      output.WRITE(value);                                         \
+    }                                                              \
+    static void read(DataInput& input, TYPE& value) {              \
+      input.readObject(&value);                                    \
+    }                                                              \
+    static void write(PdxWriter& writer, const std::string& name,  \
+                      TYPE value) {                                \
+      writer.WRITER(name, value);                                  \
+    }                                                              \
+    static void read(PdxReader& reader, const std::string& name,   \
+                     TYPE& value) {                                \
+      value = reader.READER(name);                                 \
+    }                                                              \
+  }
+
+_GEODE_PDX_SCHEMA_FIXED_CODEC(bool, writeBoolean, writeBoolean, readBoolean);
+_GEODE_PDX_SCHEMA_FIXED_CODEC(char16_t, writeChar, writeChar, readChar);
+_GEODE_PDX_SCHEMA_FIXED_CODEC(int8_t, write, writeByte, readByte);
+_GEODE_PDX_SCHEMA_FIXED_CODEC(int16_t, writeInt, writeShort, readShort);
+_GEODE_PDX_SCHEMA_FIXED_CODEC(int32_t, writeInt, writeInt, readInt);
+_GEODE_PDX_SCHEMA_FIXED_CODEC(int64_t, writeInt, writeLong, readLong);
+_GEODE_PDX_SCHEMA_FIXED_CODEC(float, writeFloat, writeFloat, readFloat);
+_GEODE_PDX_SCHEMA_FIXED_CODEC(double, writeDouble, writeDouble, readDouble);
+
+#undef _GEODE_PDX_SCHEMA_FIXED_CODEC
+
+template <>
+struct PdxSchemaFieldCodec<std::string> {
+  static const bool variableLength = true;
+  static void write(DataOutput& output, const std::string& value) {
+    output.writeString(value);
+  }
+  static void read(DataInput& input, std::string& value) {
+    value = input.readString();
+  }
+  static void write(PdxWriter& writer, const std::string& name,
+                    const std::string& value) {
+    writer.writeString(name, value);
+  }
+  static void read(PdxReader& reader, const std::string& name,
+                   std::string& value) {
+    value = reader.readString(name);
+  }
+};
+
+#define _GEODE_PDX_SCHEMA_ARRAY_CODEC(TYPE, INPUT, WRITER, READER)      \
+  template <>                                                           \
+  struct PdxSchemaFieldCodec<std::vector<TYPE>> {                       \
+    static const bool variableLength = true;                            \
+    static void write(DataOutput& output,                               \
+                      const std::vector<TYPE>& value) {                 \
+      output.writeArrayLen(static_cast<int32_t>(value.size()));         \
+      for (auto&& element : value) {                                    \
+        PdxSchemaFieldCodec<TYPE>::write(output, element);              \
+      }                                                                 \
+    }                                                                   \
+    static void read(DataInput& input, std::vector<TYPE>& value) {      \
+      value = input.INPUT();                                            \
+    }                                                                   \
+    static void write(PdxWriter& writer, const std::string& name,       \
+                      const std::vector<TYPE>& value) {                 \
+      writer.WRITER(name, value);                                       \
+    }                                                                   \
+    static void read(PdxReader& reader, const std::string& name,        \
+                     std::vector<TYPE>& value) {                        \
+      value = reader.READER(name);                                      \
+    }                                                                   \
+  }
+
+_GEODE_PDX_SCHEMA_ARRAY_CODEC(bool, readBooleanArray, writeBooleanArray,
+                              readBooleanArray);
+_GEODE_PDX_SCHEMA_ARRAY_CODEC(char16_t, readCharArray, writeCharArray,
+                              readCharArray);
+_GEODE_PDX_SCHEMA_ARRAY_CODEC(int8_t, readByteArray, writeByteArray,
+                              readByteArray);
+_GEODE_PDX_SCHEMA_ARRAY_CODEC(int16_t, readShortArray, writeShortArray,
+                              readShortArray);
+_GEODE_PDX_SCHEMA_ARRAY_CODEC(int32_t, readIntArray, writeIntArray,
+                              readIntArray);
+_GEODE_PDX_SCHEMA_ARRAY_CODEC(int64_t, readLongArray, writeLongArray,
+                              readLongArray);
+_GEODE_PDX_SCHEMA_ARRAY_CODEC(float, readFloatArray, writeFloatArray,
+                              readFloatArray);
+_GEODE_PDX_SCHEMA_ARRAY_CODEC(double, readDoubleArray, writeDoubleArray,
+                              readDoubleArray);
+_GEODE_PDX_SCHEMA_ARRAY_CODEC(std::string, readStringArray, writeStringArray,
+                              readStringArray);
+
+#undef _GEODE_PDX_SCHEMA_ARRAY_CODEC
+
+}  // namespace internal
+
+/**
+ * Describes a single field of a PdxSchemaSerializable class as a pointer to
+ * the data member holding its value.
+ */
+template <class Class, class Type, Type Class::*Member>
+struct PdxSchemaField {
+  typedef internal::PdxSchemaFieldCodec<Type> Codec;
+
+  static void write(const Class& object, DataOutput& output,
+                    std::vector<int32_t>& offsets) {
+    if (Codec::variableLength) {
+      offsets.push_back(static_cast<int32_t>(output.getBufferLength()));
+    }
+    Codec::write(output, object.*Member);
+  }
+
+  static void read(Class& object, DataInput& input) {
+    Codec::read(input, object.*Member);
+  }
+
+  static void write(const Class& object, PdxWriter& writer,
+                    const std::string& name) {
+    Codec::write(writer, name, object.*Member);
+  }
+
+  static void read(Class& object, PdxReader& reader, const std::string& name) {
+    Codec::read(reader, name, object.*Member);
+  }
+};
+
+/**
+ * The ordered list of PdxSchemaField entries making up a PDX type.
+ */
+template <class... Fields>
+struct PdxSchemaFields {
+  static const size_t size = sizeof...(Fields);
+
+  template <class Class>
+  static void write(const Class& object, DataOutput& output,
+                    std::vector<int32_t>& offsets) {
+    int expand[] = {0, (Fields::write(object, output, offsets), 0)...};
+    (void)expand;
+  }
+
+  template <class Class>
+  static void read(Class& object, DataInput& input) {
+    int expand[] = {0, (Fields::read(object, input), 0)...};
+    (void)expand;
+  }
+
+  template <class Class>
+  static void write(const Class& object, PdxWriter& writer,
+                    const std::vector<std::string>& names) {
+    size_t index = 0;
+    int expand[] = {0, (Fields::write(object, writer, names[index++]), 0)...};
+    (void)expand;
+  }
+
+  template <class Class>
+  static void read(Class& object, PdxReader& reader,
+                   const std::vector<std::string>& names) {
+    size_t index = 0;
+    int expand[] = {0, (Fields::read(object, reader, names[index++]), 0)...};
+    (void)expand;
+  }
+};
+
+/**
+ * Non-template base of PdxSchemaSerializable through which the PDX
+ * serializer reaches the generated field codecs.
+ */
+class APACHE_GEODE_EXPORT PdxSchemaSerializableBase : public PdxSerializable {
+ public:
+  ~PdxSchemaSerializableBase() noexcept override;
+
+  /**
+   * Writes all fields directly in PDX field order, recording the buffer
+   * position of each variable length field in <code>offsets</code>.
+   */
+  virtual void writePdxFields(DataOutput& output,
+                              std::vector<int32_t>& offsets) const = 0;
+
+  /**
+   * Reads all fields directly in PDX field order.
+   */
+  virtual void readPdxFields(DataInput& input) = 0;
+};
+
+/**
+ * Base class for PDX types whose fields are declared once at compile time
+ * instead of being written and read by hand in toData and fromData.
+ *
+ * The derived class provides a public <code>PdxFields</code> typedef listing
+ * its fields and a static <code>pdxFieldNames()</code> returning their names
+ * in the same order:
+ *
+ * <pre>
+ * class Order : public PdxSchemaSerializable<Order> {
+ *  public:
+ *   typedef PdxSchemaFields<
+ *       PdxSchemaField<Order, int32_t, &Order::id_>,
+ *       PdxSchemaField<Order, std::string, &Order::name_>>
+ *       PdxFields;
+ *
+ *   static const std::vector<std::string>& pdxFieldNames() {
+ *     static const std::vector<std::string> names{"id", "name"};
+ *     return names;
+ *   }
+ *   ...
+ * };
+ * </pre>
+ *
+ * Once the type is registered, objects of a local type are serialized and
+ * deserialized by the generated codecs without going through PdxWriter or
+ * PdxReader. The bytes produced are identical to those of the equivalent
+ * hand written toData.
+ */
+template <class Derived>
+class PdxSchemaSerializable : public PdxSchemaSerializableBase {
+ public:
+  ~PdxSchemaSerializable() noexcept override = default;
+
+  void toData(PdxWriter& writer) const override {
+    Derived::PdxFields::write(derived(), writer, Derived::pdxFieldNames());
+  }
+
+  void fromData(PdxReader& reader) override {
+    Derived::PdxFields::read(derived(), reader, Derived::pdxFieldNames());
+  }
+
+  void writePdxFields(DataOutput& output,
+                      std::vector<int32_t>& offsets) const override {
+    Derived::PdxFields::write(derived(), output, offsets);
+  }
+
+  void readPdxFields(DataInput& input) override {
+    Derived::PdxFields::read(derived(), input);
+  }
+
+ private:
+  const Derived& derived() const { return static_cast<const Derived&>(*this); }
+
+  Derived& derived() { return static_cast<Derived&>(*this); }
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_PDXSCHEMA_H_
@@ -186,6 +186,13 @@ class APACHE_GEODE_EXPORT Pool : public std::enable_shared_from_this<Pool> {
    */
   bool getThreadLocalConnections() const;
 
+  /**
+   * Returns <code>true</code> if thread affine connections are enabled on
+   * this pool.
+   * @see PoolFactory#setThreadAffineConnections
+   */
+  bool getThreadAffineConnections() const;
+
   /**
    * Returns <code>true</code> if multiuser authentication is enabled on this
    * pool.
@@ -179,6 +179,12 @@ class APACHE_GEODE_EXPORT PoolFactory {
    */
   static constexpr bool DEFAULT_THREAD_LOCAL_CONN = false;
 
+  /**
+   * Whether thread affine connections are enabled.
+   * <p>Current value: <code>"false"</code>.
+   */
+  static constexpr bool DEFAULT_THREAD_AFFINE_CONN = false;
+
   /**
    * Whether client is in multi user secure mode
    * <p>Current value: <code>"false"</code>.
@@ -263,6 +269,26 @@ class APACHE_GEODE_EXPORT PoolFactory {
    */
   PoolFactory& setThreadLocalConnections(bool threadLocalConnections);
 
+  /**
+   * Sets the thread affine connections policy for this pool.
+   * If <code>true</code> then each thread keeps the last few connections it
+   * used, one per server, instead of returning them to the pool. Its next
+   * operations routed to those servers, like single hop operations, reuse
+   * them without going through the pool. Operations that are not routed to
+   * a particular server are still balanced over the pool.
+   * Connections a thread has not used for the idle timeout, or for the load
+   * conditioning interval if there is no idle timeout, are returned to the
+   * pool, as are all of them when the pool runs out of connections.
+   * <p>Unlike thread local connections, a connection is never held for the
+   * whole life of a thread. This setting has no effect if thread local
+   * connections are enabled.
+   *
+   * @param threadAffineConnections if <code>true</code> then enable thread
+   * affine connections.
+   * @return a reference to <code>this</code>
+   */
+  PoolFactory& setThreadAffineConnections(bool threadAffineConnections);
+
   /**
    * Sets the duration to wait for a response from a server before timing out
    * the operation and trying another server (if any are available).
@@ -23,6 +23,7 @@
 #include <chrono>
 
 #include "SelectResults.hpp"
+#include "SelectResultsStream.hpp"
 #include "internal/geode_globals.hpp"
 
 /**
@@ -90,6 +91,37 @@ class APACHE_GEODE_EXPORT Query {
   virtual std::shared_ptr<SelectResults> execute(
       std::shared_ptr<CacheableVector> paramList,
       std::chrono::milliseconds timeout = DEFAULT_QUERY_RESPONSE_TIMEOUT) = 0;
+
+  /**
+   * Executes the OQL Query on the cache server and returns a stream over the
+   * results as they arrive, rather than waiting for the complete reply.
+   *
+   * @param timeout The time to wait for each part of the query response,
+   * optional.
+   *
+   * @throws IllegalArgumentException If timeout exceeds 2147483647ms.
+   * @returns A smart pointer to the SelectResultsStream. Errors from the
+   * server are thrown by SelectResultsStream::next.
+   */
+  virtual std::shared_ptr<SelectResultsStream> executeStreaming(
+      std::chrono::milliseconds timeout = DEFAULT_QUERY_RESPONSE_TIMEOUT) = 0;
+
+  /**
+   * Executes the parameterized OQL Query on the cache server and returns a
+   * stream over the results as they arrive.
+   *
+   * @param paramList The query parameters list
+   * @param timeout The time to wait for each part of the query response,
+   * optional.
+   *
+   * @throws IllegalArgumentException If timeout exceeds 2147483647ms.
+   * @returns A smart pointer to the SelectResultsStream. Errors from the
+   * server are thrown by SelectResultsStream::next.
+   */
+  virtual std::shared_ptr<SelectResultsStream> executeStreaming(
+      std::shared_ptr<CacheableVector> paramList,
+      std::chrono::milliseconds timeout = DEFAULT_QUERY_RESPONSE_TIMEOUT) = 0;
+
   /**
    * Get the query string provided when a new Query was created from a
    * QueryService.
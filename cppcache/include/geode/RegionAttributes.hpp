@@ -34,6 +34,7 @@
 #include "PartitionResolver.hpp"
 #include "Properties.hpp"
 #include "Serializable.hpp"
+#include "ValueStorageType.hpp"
 #include "internal/DataSerializableInternal.hpp"
 #include "internal/chrono/duration.hpp"
 #include "internal/geode_globals.hpp"
@@ -177,6 +178,19 @@ class APACHE_GEODE_EXPORT RegionAttributes
    */
   DiskPolicyType getDiskPolicy() const;
 
+  /** Returns the form in which the region keeps its values.
+   *
+   * @return the <code>ValueStorageType</code>, default is
+   * ValueStorageType::OBJECT.
+   */
+  ValueStorageType getValueStorage() const;
+
+  /**
+   * Returns the number of deserialized values kept at hand by a region
+   * storing serialized or compressed values, default is 0.
+   */
+  uint32_t getDeserializedValueCacheSize() const;
+
   /**
    * Returns the ExpirationAction used for LRU Eviction, default is
    * LOCAL_DESTROY.
@@ -330,6 +344,8 @@ class APACHE_GEODE_EXPORT RegionAttributes
   void setLruEntriesLimit(int limit);
   void setDiskPolicy(DiskPolicyType diskPolicy);
   void setConcurrencyChecksEnabled(bool enable);
+  void setValueStorage(ValueStorageType valueStorage);
+  void setDeserializedValueCacheSize(uint32_t size);
 
   inline bool getEntryExpiryEnabled() const {
     return (m_entryTimeToLive > std::chrono::seconds::zero() ||
@@ -378,6 +394,8 @@ class APACHE_GEODE_EXPORT RegionAttributes
   std::string m_poolName;
   bool m_isClonable;
   bool m_isConcurrencyChecksEnabled;
+  ValueStorageType m_valueStorage;
+  uint32_t m_deserializedValueCacheSize;
   friend class RegionAttributesFactory;
   friend class AttributesMutator;
   friend class Cache;
@@ -427,6 +427,27 @@ class APACHE_GEODE_EXPORT RegionAttributesFactory {
   RegionAttributesFactory& setConcurrencyChecksEnabled(
       bool concurrencyChecksEnabled);
 
+  /**
+   * Sets the form in which the region keeps its values. Regions storing
+   * serialized or compressed values return a newly deserialized copy on
+   * every access, so changes to a value returned by get are not reflected in
+   * the region.
+   * @param valueStorage the form of the values of a caching region
+   * @return a reference to <code>this</code>
+   * @see RegionAttributes#getValueStorage()
+   */
+  RegionAttributesFactory& setValueStorage(ValueStorageType valueStorage);
+
+  /**
+   * Sets how many of the most recently deserialized values a region storing
+   * serialized or compressed values keeps at hand. Those values are shared
+   * by all readers until they are replaced or pushed out.
+   * @param size the number of deserialized values, 0 to keep none
+   * @return a reference to <code>this</code>
+   * @see RegionAttributes#getDeserializedValueCacheSize()
+   */
+  RegionAttributesFactory& setDeserializedValueCacheSize(uint32_t size);
+
   // FACTORY METHOD
 
   /**
@@ -262,6 +262,21 @@ class APACHE_GEODE_EXPORT RegionFactory {
    */
   RegionFactory& setConcurrencyChecksEnabled(bool enable);
 
+  /**
+   * Sets the form in which the region keeps its values.
+   * @param valueStorage the form of the values of a caching region
+   * @return a reference to <code>this</code>
+   */
+  RegionFactory& setValueStorage(ValueStorageType valueStorage);
+
+  /**
+   * Sets how many recently deserialized values a region storing serialized
+   * or compressed values keeps at hand.
+   * @param size the number of deserialized values, 0 to keep none
+   * @return a reference to <code>this</code>
+   */
+  RegionFactory& setDeserializedValueCacheSize(uint32_t size);
+
  private:
   RegionFactory(apache::geode::client::RegionShortcut preDefinedRegion,
                 CacheImpl* cacheImpl);
@@ -0,0 +1,73 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_SELECTRESULTSSTREAM_H_
+#define GEODE_SELECTRESULTSSTREAM_H_
+
+#include <memory>
+
+#include "Serializable.hpp"
+#include "internal/geode_globals.hpp"
+
+/**
+ * @file
+ */
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * @class SelectResultsStream SelectResultsStream.hpp
+ *
+ * A SelectResultsStream is obtained by executing a Query with
+ * Query::executeStreaming. Results are handed out as each chunk of the
+ * server reply is received and deserialized, so the first result is
+ * available without waiting for the complete reply. Only a few chunks are
+ * buffered ahead of the reader; when the reader falls behind, reading from
+ * the server connection pauses.
+ *
+ * Results of a ResultSet query are returned as they are, results of a
+ * StructSet query as Struct objects.
+ *
+ * This class is not thread-safe. Destroying the stream before it is
+ * exhausted discards the remaining results.
+ */
+class APACHE_GEODE_EXPORT SelectResultsStream {
+ public:
+  virtual ~SelectResultsStream() noexcept = default;
+
+  /**
+   * Waits for the next result.
+   *
+   * @param result set to the next result, which may be null.
+   *
+   * @throws QueryException if some query error occurred at the server.
+   * @throws IllegalStateException if some error occurred.
+   * @throws NotConnectedException if no java cache server is available.
+   * @returns false once all results have been returned.
+   */
+  virtual bool next(std::shared_ptr<Serializable>& result) = 0;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_SELECTRESULTSSTREAM_H_
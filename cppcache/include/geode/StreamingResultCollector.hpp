@@ -0,0 +1,130 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_STREAMINGRESULTCOLLECTOR_H_
+#define GEODE_STREAMINGRESULTCOLLECTOR_H_
+
+#include <chrono>
+#include <memory>
+
+#include "CacheableBuiltins.hpp"
+#include "ResultCollector.hpp"
+#include "internal/geode_globals.hpp"
+
+/**
+ * @file
+ */
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * @class StreamingResultCollector StreamingResultCollector.hpp
+ *
+ * A ResultCollector whose results can be consumed while the function is
+ * still executing. Results are handed out by next as soon as the chunk
+ * carrying them is received from any of the servers, so large result sets
+ * of onServers and onRegion executions need not be held in memory at once.
+ *
+ * Results arriving from different servers are added in parallel without
+ * taking a lock. The results of each server are returned in the order the
+ * server sent them; results of different servers are interleaved.
+ *
+ * With a non-zero capacity, reading from the server connections pauses
+ * while about that many results are waiting to be consumed. Since
+ * Execution::execute only returns once all servers have replied, results
+ * must then be consumed from another thread:
+ *
+ * <pre>
+ * auto rc = std::make_shared<StreamingResultCollector>(1000);
+ * auto execution = std::async(std::launch::async, [&] {
+ *   FunctionService::onServers(pool).withCollector(rc).execute(function);
+ * });
+ * std::shared_ptr<Cacheable> result;
+ * while (rc->next(result)) {
+ *   ...
+ * }
+ * </pre>
+ *
+ * Results are read by a single consumer at a time.
+ *
+ * A highly available function that fails on a server is executed again.
+ * Since results already consumed can not be taken back, the collector then
+ * fails instead: next, getResult and the re-execution itself throw. Results
+ * still arriving are dropped.
+ */
+class APACHE_GEODE_EXPORT StreamingResultCollector : public ResultCollector {
+ public:
+  /**
+   * @param capacity the number of results buffered ahead of the consumer
+   * before the servers are throttled, or 0 for no limit.
+   */
+  explicit StreamingResultCollector(size_t capacity = 0);
+  ~StreamingResultCollector() noexcept override;
+
+  StreamingResultCollector(const StreamingResultCollector&) = delete;
+  StreamingResultCollector& operator=(const StreamingResultCollector&) =
+      delete;
+
+  /**
+   * Waits for the next result.
+   *
+   * @param result set to the next result, which may be null.
+   * @param timeout if no result arrives within this time, exception will be
+   * thrown
+   *
+   * @throws FunctionExecutionException if no result arrived in time.
+   * @returns false once all results have been returned.
+   */
+  bool next(std::shared_ptr<Cacheable>& result,
+            std::chrono::milliseconds timeout = DEFAULT_QUERY_RESPONSE_TIMEOUT);
+
+  /**
+   * Waits for the function execution to complete and returns all results
+   * not yet returned by next.
+   */
+  std::shared_ptr<CacheableVector> getResult(
+      std::chrono::milliseconds timeout =
+          DEFAULT_QUERY_RESPONSE_TIMEOUT) override;
+
+  void addResult(
+      const std::shared_ptr<Cacheable>& resultOfSingleExecution) override;
+
+  void endResults() override;
+
+  /**
+   * Discards the results added so far.
+   *
+   * @throws FunctionExecutionException if results have already been
+   * consumed.
+   */
+  void clearResults() override;
+
+ private:
+  class Shards;
+
+  std::unique_ptr<Shards> shards_;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_STREAMINGRESULTCOLLECTOR_H_
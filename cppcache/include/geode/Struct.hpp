@@ -57,6 +57,13 @@ class APACHE_GEODE_EXPORT Struct
   Struct(StructSet* ssPtr,
          std::vector<std::shared_ptr<Serializable>>& fieldValues);
 
+  /**
+   * Constructor - meant only for internal use. The Struct shares ownership
+   * of its parent, so it stays usable after the parent's creator is gone.
+   */
+  Struct(std::shared_ptr<StructSet> ssPtr,
+         std::vector<std::shared_ptr<Serializable>>& fieldValues);
+
   Struct() = default;
 
   ~Struct() noexcept override = default;
@@ -127,6 +134,7 @@ class APACHE_GEODE_EXPORT Struct
   typedef std::unordered_map<std::string, int32_t> FieldNameToIndexMap;
 
   StructSet* m_parent = nullptr;
+  std::shared_ptr<StructSet> m_parentOwner;
   std::vector<std::shared_ptr<Serializable>> m_fieldValues;
   FieldNameToIndexMap m_fieldNameToIndex;
 };
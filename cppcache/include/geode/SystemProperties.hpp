@@ -67,6 +67,42 @@ class APACHE_GEODE_EXPORT SystemProperties {
 
   uint32_t threadPoolSize() const { return m_threadPoolSize; }
 
+  /**
+   * Returns the number of threads that receive the events of all
+   * subscription channels together, or 0 if every subscription channel
+   * receives its events on a thread of its own.
+   */
+  uint32_t subscriptionReactorThreads() const {
+    return m_subscriptionReactorThreads;
+  }
+
+  /**
+   * Returns the number of entries above which putAll, getAll and removeAll
+   * are split into sub-batches of that size, or 0 if they are never split.
+   */
+  uint32_t bulkOpBatchSize() const { return m_bulkOpBatchSize; }
+
+  /**
+   * Returns the number of sub-batches of a split bulk operation that are
+   * sent at the same time.
+   */
+  uint32_t bulkOpBatchesInFlight() const { return m_bulkOpBatchesInFlight; }
+
+  /**
+   * Whether concurrent cache misses of the same key in a caching region with
+   * concurrency checks enabled share a single CacheLoader::load call.
+   */
+  bool cacheLoaderCoalescingEnabled() const {
+    return m_cacheLoaderCoalescingEnabled;
+  }
+
+  /**
+   * Whether a put of a PdxInstance read from the server only sends the fields
+   * that were set on it, and whether such deltas from the server are applied
+   * to cached instances. The server must be able to apply such a delta.
+   */
+  bool pdxInstanceDeltaEnabled() const { return m_pdxInstanceDeltaEnabled; }
+
   /**
    * Returns the sampling interval of the sampling thread.
    * This would be how often the statistics thread writes to disk.
@@ -90,6 +126,13 @@ class APACHE_GEODE_EXPORT SystemProperties {
    */
   bool getEnableTimeStatistics() const { return m_timestatisticsEnabled; }
 
+  /**
+   * Whether time stats of region operations are taken from a clock that is
+   * advanced every millisecond rather than read on every operation. Cheaper,
+   * but individual operations shorter than a millisecond mostly count as 0.
+   */
+  bool getCoarseTimeStatistics() const { return m_coarseTimeStatistics; }
+
   /**
    * Returns the path of the private key file for SSL use.
    */
@@ -163,6 +206,12 @@ class APACHE_GEODE_EXPORT SystemProperties {
    */
   int32_t maxSocketBufferSize() const { return m_maxSocketBufferSize; }
 
+  /**
+   * Whether plain socket connections send and receive through io_uring
+   * where the platform supports it.
+   */
+  bool ioUringEnabled() const { return m_ioUringEnabled; }
+
   /**
    * Returns the time between two consecutive pings to servers
    */
@@ -377,6 +426,7 @@ class APACHE_GEODE_EXPORT SystemProperties {
   int32_t m_heapLRULimit;
   int32_t m_heapLRUDelta;
   int32_t m_maxSocketBufferSize;
+  bool m_ioUringEnabled;
   std::chrono::seconds m_pingInterval;
   std::chrono::seconds m_redundancyMonitorInterval;
 
@@ -399,6 +449,7 @@ class APACHE_GEODE_EXPORT SystemProperties {
 
   bool m_sslEnabled;
   bool m_timestatisticsEnabled;
+  bool m_coarseTimeStatistics;
   std::string m_sslKeyStore;
   std::string m_sslTrustStore;
 
@@ -407,6 +458,11 @@ class APACHE_GEODE_EXPORT SystemProperties {
   std::string m_conflateEvents;
 
   uint32_t m_threadPoolSize;
+  uint32_t m_subscriptionReactorThreads;
+  uint32_t m_bulkOpBatchSize;
+  uint32_t m_bulkOpBatchesInFlight;
+  bool m_cacheLoaderCoalescingEnabled;
+  bool m_pdxInstanceDeltaEnabled;
   std::chrono::seconds m_suspendedTxTimeout;
   std::chrono::milliseconds m_tombstoneTimeout;
   bool m_enableChunkHandlerThread;
@@ -0,0 +1,49 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_VALUESTORAGETYPE_H_
+#define GEODE_VALUESTORAGETYPE_H_
+
+/**
+ * @file
+ */
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * @enum ValueStorageType ValueStorageType.hpp
+ * Enumerated type for the form in which a caching region keeps its values.
+ *
+ * OBJECT keeps the deserialized objects. SERIALIZED keeps their serialized
+ * form and deserializes on every access, COMPRESSED additionally compresses
+ * it. The latter two trade CPU for memory and suit regions whose values are
+ * large and rarely read.
+ *
+ * @see RegionAttributes::getValueStorage
+ * @see RegionAttributesFactory::setValueStorage
+ */
+enum class ValueStorageType { OBJECT = 0, SERIALIZED, COMPRESSED };
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_VALUESTORAGETYPE_H_
@@ -64,6 +64,8 @@ CacheImpl::CacheImpl(Cache* c, const std::shared_ptr<Properties>& dsProps,
       m_initialized(false),
       m_distributedSystem(DistributedSystem::create(DEFAULT_DS_NAME, dsProps)),
       m_clientProxyMembershipIDFactory(m_distributedSystem.getName()),
+      m_regionHandles(),
+      m_regionHandlesGeneration(0),
       m_cache(c),
       m_tcrConnectionManager(nullptr),
       m_remoteQueryServicePtr(nullptr),
@@ -165,6 +167,7 @@ void CacheImpl::removeRegion(const std::string& name) {
   if (!m_destroyPending) {
     m_regions.erase(name);
   }
+  clearRegionHandles();
 }
 
 std::shared_ptr<QueryService> CacheImpl::getQueryService(bool noInit) {
@@ -311,6 +314,7 @@ void CacheImpl::close(bool keepalive) {
   }
 
   m_regions.clear();
+  clearRegionHandles();
   LOGDEBUG("CacheImpl::close( ): destroyed regions.");
 
   _GEODE_SAFE_DELETE(m_tcrConnectionManager);
@@ -429,6 +433,7 @@ void CacheImpl::createRegion(std::string name,
     rpImpl->acquireReadLock();
     m_regions.emplace(regionPtr->getName(), regionPtr);
   }
+  clearRegionHandles();
 
   // When region is created, added that region name in client meta data
   // service to fetch its metadata for single hop.
@@ -505,6 +510,43 @@ std::shared_ptr<Region> CacheImpl::getRegion(const std::string& path) {
   return region;
 }
 
+std::shared_ptr<Region> CacheImpl::getRegionHandle(const std::string& path) {
+  auto handle = m_regionHandles.read(
+      [&path](const RegionHandles& handles) -> std::shared_ptr<Region> {
+        auto&& found = handles.find(path);
+        if (found != handles.end() && !found->second->isDestroyed()) {
+          return found->second;
+        }
+        return nullptr;
+      });
+  if (handle) {
+    return handle;
+  }
+
+  uint64_t generation;
+  {
+    std::lock_guard<decltype(m_regionHandlesMutex)> lock(m_regionHandlesMutex);
+    generation = m_regionHandlesGeneration;
+  }
+
+  auto region = getRegion(path);
+  if (region) {
+    std::lock_guard<decltype(m_regionHandlesMutex)> lock(m_regionHandlesMutex);
+    // a region created or destroyed meanwhile may have made this one stale
+    if (generation == m_regionHandlesGeneration) {
+      m_regionHandles.update(
+          [&path, &region](RegionHandles& handles) { handles[path] = region; });
+    }
+  }
+  return region;
+}
+
+void CacheImpl::clearRegionHandles() {
+  std::lock_guard<decltype(m_regionHandlesMutex)> lock(m_regionHandlesMutex);
+  ++m_regionHandlesGeneration;
+  m_regionHandles.clear();
+}
+
 std::shared_ptr<RegionInternal> CacheImpl::createRegion_internal(
     const std::string& name, const std::shared_ptr<RegionInternal>& rootRegion,
     const RegionAttributes& attrs,
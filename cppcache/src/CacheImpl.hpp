@@ -37,6 +37,7 @@
 #include "PdxTypeRegistry.hpp"
 #include "RemoteQueryService.hpp"
 #include "ThreadPool.hpp"
+#include "util/concurrent/snapshot.hpp"
 #include "util/synchronized_map.hpp"
 
 #define DEFAULT_LRU_MAXIMUM_ENTRIES 100000
@@ -173,6 +174,19 @@ class APACHE_GEODE_EXPORT CacheImpl {
    */
   std::shared_ptr<Region> getRegion(const std::string& path);
 
+  /**
+   * Like getRegion, but resolves paths through a snapshot of previously
+   * resolved regions that is read without locking. For the subscription
+   * event path, where the same few regions are looked up for every event.
+   */
+  std::shared_ptr<Region> getRegionHandle(const std::string& path);
+
+  /**
+   * Forgets all resolved region handles. Called whenever a region or
+   * subregion is created or destroyed.
+   */
+  void clearRegionHandles();
+
   /**
    * Returns a set of root regions in the cache. Does not cause any
    * shared regions to be mapped into the cache. This set is a snapshot and
@@ -354,6 +368,14 @@ class APACHE_GEODE_EXPORT CacheImpl {
   synchronized_map<std::unordered_map<std::string, std::shared_ptr<Region>>,
                    std::recursive_mutex>
       m_regions;
+
+  typedef std::unordered_map<std::string, std::shared_ptr<Region>>
+      RegionHandles;
+  util::concurrent::snapshot<RegionHandles> m_regionHandles;
+  std::mutex m_regionHandlesMutex;
+  // incremented under m_regionHandlesMutex by every clearRegionHandles
+  uint64_t m_regionHandlesGeneration;
+
   Cache* m_cache;
   std::unique_ptr<EvictionController> m_evictionController;
   TcrConnectionManager* m_tcrConnectionManager;
@@ -61,6 +61,10 @@ auto LRU_ENTRIES_LIMIT = "lru-entries-limit";
 
 auto DISK_POLICY = "disk-policy";
 
+auto VALUE_STORAGE = "value-storage";
+
+auto DESERIALIZED_VALUE_CACHE_SIZE = "deserialized-value-cache-size";
+
 auto ENDPOINTS = "endpoints";
 
 /** The name of the <code>region-time-to-live</code> element */
@@ -151,6 +155,15 @@ auto PERSIST = "persist";
 /** The name of the <code>none</code> value */
 auto NONE = "none";
 
+/** The name of the <code>object</code> value */
+auto OBJECT = "object";
+
+/** The name of the <code>serialized</code> value */
+auto SERIALIZED = "serialized";
+
+/** The name of the <code>compressed</code> value */
+auto COMPRESSED = "compressed";
+
 /** The name of the <code>local-invalidate</code> value */
 auto LOCAL_INVALIDATE = "local-invalidate";
 
@@ -196,6 +209,7 @@ auto SUBSCRIPTION_ACK_INTERVAL = "subscription-ack-interval";
 auto SUBSCRIPTION_ENABLED = "subscription-enabled";
 auto SUBSCRIPTION_MTT = "subscription-message-tracking-timeout";
 auto SUBSCRIPTION_REDUNDANCY = "subscription-redundancy";
+auto THREAD_AFFINE_CONNECTIONS = "thread-affine-connections";
 auto THREAD_LOCAL_CONNECTIONS = "thread-local-connections";
 auto CLONING_ENABLED = "cloning-enabled";
 auto ID = "id";
@@ -736,6 +750,16 @@ void CacheXmlParser::startPool(const xercesc::Attributes &attrs) {
     }
   }
 
+  auto threadAffineConnections =
+      getOptionalAttribute(attrs, THREAD_AFFINE_CONNECTIONS);
+  if (!threadAffineConnections.empty()) {
+    if (equal_ignore_case(threadAffineConnections, "true")) {
+      factory->setThreadAffineConnections(true);
+    } else {
+      factory->setThreadAffineConnections(false);
+    }
+  }
+
   auto prSingleHopEnabled = getOptionalAttribute(attrs, PR_SINGLE_HOP_ENABLED);
   if (!prSingleHopEnabled.empty()) {
     if (equal_ignore_case(prSingleHopEnabled, "true")) {
@@ -902,6 +926,30 @@ void CacheXmlParser::startRegionAttributes(const xercesc::Attributes &attrs) {
       regionAttributesFactory->setDiskPolicy(diskPolicy);
     }
 
+    auto valueStorageString = getOptionalAttribute(attrs, VALUE_STORAGE);
+    if (!valueStorageString.empty()) {
+      auto valueStorage = ValueStorageType::OBJECT;
+      if (OBJECT == valueStorageString) {
+        valueStorage = ValueStorageType::OBJECT;
+      } else if (SERIALIZED == valueStorageString) {
+        valueStorage = ValueStorageType::SERIALIZED;
+      } else if (COMPRESSED == valueStorageString) {
+        valueStorage = ValueStorageType::COMPRESSED;
+      } else {
+        throw CacheXmlException(
+            "XML: " + valueStorageString +
+            " is not a valid name for the attribute <value-storage>");
+      }
+      regionAttributesFactory->setValueStorage(valueStorage);
+    }
+
+    auto deserializedValueCacheSize =
+        getOptionalAttribute(attrs, DESERIALIZED_VALUE_CACHE_SIZE);
+    if (!deserializedValueCacheSize.empty()) {
+      regionAttributesFactory->setDeserializedValueCacheSize(
+          std::stoi(deserializedValueCacheSize));
+    }
+
     auto endpoints = getOptionalAttribute(attrs, ENDPOINTS);
     if (!endpoints.empty()) {
       if (poolFactory_) {
@@ -102,7 +102,7 @@ void CacheableObjectPartList::fromData(DataInput& input) {
         // if value has already been received via notification or put by
         // another thread, then return that
         if (oldValue != nullptr && !CacheableToken::isInvalid(oldValue)) {
-          value = oldValue;
+          value = m_region->loadValue(oldValue);
         }
         if (m_values != nullptr) {
           m_values->emplace(key, value);
@@ -100,7 +100,7 @@ GfErrType ConcurrentEntriesMap::invalidate(
 }
 
 GfErrType ConcurrentEntriesMap::put(const std::shared_ptr<CacheableKey>& key,
-                                    const std::shared_ptr<Cacheable>& newValue,
+                                    std::shared_ptr<Cacheable>& newValue,
                                     std::shared_ptr<MapEntryImpl>& me,
                                     std::shared_ptr<Cacheable>& oldValue,
                                     int updateCount, int destroyTracker,
@@ -89,7 +89,7 @@ class APACHE_GEODE_EXPORT ConcurrentEntriesMap : public EntriesMap {
   virtual void clear();
 
   virtual GfErrType put(const std::shared_ptr<CacheableKey>& key,
-                        const std::shared_ptr<Cacheable>& newValue,
+                        std::shared_ptr<Cacheable>& newValue,
                         std::shared_ptr<MapEntryImpl>& me,
                         std::shared_ptr<Cacheable>& oldValue, int updateCount,
                         int destroyTracker,
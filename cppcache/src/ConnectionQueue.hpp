@@ -21,8 +21,8 @@
 #define GEODE_SYNCHRONIZEDQUEUE_H_
 
 #include <condition_variable>
-#include <deque>
 #include <mutex>
+#include <unordered_map>
 
 #include "util/Log.hpp"
 
@@ -30,12 +30,34 @@ namespace apache {
 namespace geode {
 namespace client {
 
+/**
+ * Queue of idle connections. Connections are returned to the front and
+ * handed out from the back.
+ *
+ * Each connection is additionally linked into a per partition list, see
+ * partitionOf, so that a connection for a given partition can be checked
+ * out or removed without scanning the whole queue.
+ */
 template <class T, class _Mutex = std::mutex>
 class ConnectionQueue {
  public:
-  ConnectionQueue() : closed_(false) {}
+  ConnectionQueue()
+      : closed_(false),
+        front_(nullptr),
+        back_(nullptr),
+        freeNodes_(nullptr),
+        size_(0) {}
 
-  virtual ~ConnectionQueue() {}
+  virtual ~ConnectionQueue() {
+    while (back_) {
+      unlink(back_);
+    }
+    while (freeNodes_) {
+      auto node = freeNodes_;
+      freeNodes_ = node->next;
+      delete node;
+    }
+  }
 
   /** get without wait */
   T* getNoWait() {
@@ -60,7 +82,7 @@ class ConnectionQueue {
       std::lock_guard<_Mutex> _guard(mutex_);
       {
         if (openQueue || !closed_) {
-          queue_.push_front(mp);
+          pushNoLock(mp);
           closed_ = false;
         } else {
           delMp = true;
@@ -76,12 +98,12 @@ class ConnectionQueue {
 
   size_t size() const {
     std::lock_guard<_Mutex> _guard(mutex_);
-    return static_cast<uint32_t>(queue_.size());
+    return static_cast<uint32_t>(size_);
   }
 
   bool empty() const {
     std::lock_guard<_Mutex> _guard(mutex_);
-    return queue_.empty();
+    return size_ == 0;
   }
 
   void close() {
@@ -89,10 +111,9 @@ class ConnectionQueue {
       std::lock_guard<_Mutex> _guard(mutex_);
 
       closed_ = true;
-      LOGDEBUG("Internal fair queue size while closing is %zu", queue_.size());
-      while (!queue_.empty()) {
-        auto mp = queue_.back();
-        queue_.pop_back();
+      LOGDEBUG("Internal fair queue size while closing is %zu", size_);
+      while (back_) {
+        auto mp = unlink(back_);
         mp->close();
         delete mp;
         deleteAction();
@@ -108,8 +129,22 @@ class ConnectionQueue {
   }
 
  private:
+  struct Node {
+    T* value;
+    Node* prev;
+    Node* next;
+    Node** partitionFront;
+    Node* partitionPrev;
+    Node* partitionNext;
+  };
+
   std::condition_variable_any condition_;
   bool closed_;
+  Node* front_;
+  Node* back_;
+  Node* freeNodes_;
+  size_t size_;
+  std::unordered_map<const void*, Node*> partitions_;
 
   T* popLocked(bool& isClosed) {
     std::lock_guard<_Mutex> _guard(mutex_);
@@ -118,21 +153,96 @@ class ConnectionQueue {
 
   bool exclude(T*, void*) { return false; }
 
+  T* unlink(Node* node) {
+    if (node->prev) {
+      node->prev->next = node->next;
+    } else {
+      front_ = node->next;
+    }
+    if (node->next) {
+      node->next->prev = node->prev;
+    } else {
+      back_ = node->prev;
+    }
+
+    if (node->partitionPrev) {
+      node->partitionPrev->partitionNext = node->partitionNext;
+    } else {
+      *node->partitionFront = node->partitionNext;
+    }
+    if (node->partitionNext) {
+      node->partitionNext->partitionPrev = node->partitionPrev;
+    }
+
+    --size_;
+    auto mp = node->value;
+    node->next = freeNodes_;
+    freeNodes_ = node;
+    return mp;
+  }
+
  protected:
-  std::deque<T*> queue_;
   mutable _Mutex mutex_;
 
+  /**
+   * Partition a connection is filed under. Connections in the same partition
+   * can be checked out with popNoLock(partition) in constant time.
+   */
+  virtual const void* partitionOf(const T*) const { return nullptr; }
+
+  void pushNoLock(T* mp) {
+    Node* node = freeNodes_;
+    if (node) {
+      freeNodes_ = node->next;
+    } else {
+      node = new Node;
+    }
+    node->value = mp;
+
+    node->prev = nullptr;
+    node->next = front_;
+    if (front_) {
+      front_->prev = node;
+    } else {
+      back_ = node;
+    }
+    front_ = node;
+
+    // references into an unordered_map are stable across rehashing
+    auto& partitionFront = partitions_[partitionOf(mp)];
+    node->partitionFront = &partitionFront;
+    node->partitionPrev = nullptr;
+    node->partitionNext = partitionFront;
+    if (partitionFront) {
+      partitionFront->partitionPrev = node;
+    }
+    partitionFront = node;
+
+    ++size_;
+  }
+
   inline T* popNoLock(bool& isClosed) {
     T* mp = nullptr;
 
     isClosed = closed_;
-    if (!isClosed && queue_.size() > 0) {
-      mp = queue_.back();
-      queue_.pop_back();
+    if (!isClosed && back_) {
+      mp = unlink(back_);
     }
     return mp;
   }
 
+  /**
+   * Removes the most recently returned connection of the given partition,
+   * or returns nullptr if the partition holds no connection.
+   */
+  T* popNoLock(const void* partition) {
+    auto found = partitions_.find(partition);
+    if (found == partitions_.end() || !found->second) {
+      return nullptr;
+    }
+    return unlink(found->second);
+  }
+
   template <typename U>
   T* getLockedFor(const std::chrono::microseconds& duration, bool& isClosed,
                   U* excludeList = nullptr) {
@@ -141,7 +251,7 @@ class ConnectionQueue {
 
     std::unique_lock<_Mutex> lock(mutex_);
     while (condition_.wait_until(
-        lock, until, [&]() { return closed_ || !queue_.empty(); })) {
+        lock, until, [&]() { return closed_ || back_ != nullptr; })) {
       mp = popNoLock(isClosed);
       if (mp && excludeList) {
         if (exclude(mp, excludeList)) {
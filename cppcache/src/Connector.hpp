@@ -21,6 +21,7 @@
 #define GEODE_CONNECTOR_H_
 
 #include <chrono>
+#include <cstdint>
 
 #include <geode/internal/geode_globals.hpp>
 
@@ -101,6 +102,17 @@ class Connector {
    * Returns local port for this TCP connection
    */
   virtual uint16_t getPort() = 0;
+
+  /**
+   * Returns the handle of the socket to watch for incoming data, or -1 if
+   * data may be waiting in layers the socket's readiness does not reflect.
+   */
+  virtual std::intptr_t getReadHandle() const { return -1; }
+
+  /**
+   * Returns true if received data is waiting in this connector's own buffer.
+   */
+  virtual bool hasBufferedData() const { return false; }
 };
 }  // namespace client
 }  // namespace geode
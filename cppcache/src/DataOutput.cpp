@@ -136,18 +136,23 @@ const SerializationRegistry& DataOutput::getSerializationRegistry() const {
 
 Cache* DataOutput::getCache() const { return m_cache->getCache(); }
 
+template <class _CharT>
+void DataOutput::writeJavaModifiedUtf8Units(const _CharT* data, size_t len) {
+  // longer strings are cut short after the last whole character that fits
+  const auto encodedLen =
+      std::min<size_t>(internal::JavaModifiedUtf8::encodedLength(data, len),
+                       std::numeric_limits<uint16_t>::max());
+  ensureCapacity(encodedLen + 2);
+  const auto written = internal::JavaModifiedUtf8::encode(
+      data, len, reinterpret_cast<char*>(m_buf + 2), encodedLen);
+  writeInt(static_cast<uint16_t>(written));
+  m_buf += written;
+}
+
 template <class _Traits, class _Allocator>
 void DataOutput::writeJavaModifiedUtf8(
     const std::basic_string<char, _Traits, _Allocator>& value) {
-  /*
-   * OPTIMIZE convert from UTF-8 to CESU-8/Java Modified UTF-8 directly
-   * http://www.unicode.org/reports/tr26/
-   */
-  if (value.empty()) {
-    writeInt(static_cast<uint16_t>(0));
-  } else {
-    writeJavaModifiedUtf8(to_utf16(value));
-  }
+  writeJavaModifiedUtf8Units(value.data(), value.length());
 }
 template APACHE_GEODE_EXPLICIT_TEMPLATE_EXPORT void
 DataOutput::writeJavaModifiedUtf8(const std::string&);
@@ -155,26 +160,17 @@ DataOutput::writeJavaModifiedUtf8(const std::string&);
 template <class _Traits, class _Allocator>
 void DataOutput::writeJavaModifiedUtf8(
     const std::basic_string<char32_t, _Traits, _Allocator>& value) {
-  /*
-   * OPTIMIZE convert from UCS-4 to CESU-8/Java Modified UTF-8 directly
-   * http://www.unicode.org/reports/tr26/
-   */
-  if (value.empty()) {
-    writeInt(static_cast<uint16_t>(0));
-  } else {
-    writeJavaModifiedUtf8(to_utf16(value));
-  }
+  writeJavaModifiedUtf8Units(value.data(), value.length());
 }
 template APACHE_GEODE_EXPLICIT_TEMPLATE_EXPORT void
 DataOutput::writeJavaModifiedUtf8(const std::u32string&);
 
+void DataOutput::writeJavaModifiedUtf8(const char16_t* data, size_t len) {
+  writeJavaModifiedUtf8Units(data, len);
+}
+
 void DataOutput::writeJavaModifiedUtf8(const char32_t* data, size_t len) {
-  // TODO string optimize from UCS-4 to jmutf8
-  if (0 == len) {
-    writeInt(static_cast<uint16_t>(0));
-  } else {
-    writeJavaModifiedUtf8(to_utf16(data, len));
-  }
+  writeJavaModifiedUtf8Units(data, len);
 }
 
 size_t DataOutput::getJavaModifiedUtf8EncodedLength(const char16_t* data,
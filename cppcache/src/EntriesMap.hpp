@@ -59,7 +59,7 @@ class APACHE_GEODE_EXPORT EntriesMap {
    * @brief put a value in the map, replacing if key already exists.
    */
   virtual GfErrType put(const std::shared_ptr<CacheableKey>& key,
-                        const std::shared_ptr<Cacheable>& newValue,
+                        std::shared_ptr<Cacheable>& newValue,
                         std::shared_ptr<MapEntryImpl>& me,
                         std::shared_ptr<Cacheable>& oldValue, int updateCount,
                         int destroyTracker,
@@ -126,6 +126,15 @@ class APACHE_GEODE_EXPORT EntriesMap {
   virtual void getValues(
       std::vector<std::shared_ptr<Cacheable>>& result) const = 0;
 
+  /**
+   * @brief return the object form of a value that the map handed out or
+   * that was received for it in stored form, e.g. the old value of put.
+   */
+  virtual std::shared_ptr<Cacheable> load(
+      const std::shared_ptr<Cacheable>& value) const {
+    return value;
+  }
+
   /** @brief return the number of entries in the map. */
   virtual uint32_t size() const = 0;
 
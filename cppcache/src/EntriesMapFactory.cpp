@@ -23,6 +23,7 @@
 #include "ExpMapEntry.hpp"
 #include "LRUEntriesMap.hpp"
 #include "LRUExpMapEntry.hpp"
+#include "SerializedEntriesMap.hpp"
 //#include <geode/ExpirationAction.hpp>
 #include <geode/SystemProperties.hpp>
 
@@ -30,6 +31,20 @@ namespace apache {
 namespace geode {
 namespace client {
 
+namespace {
+
+template <class TMap, class... Args>
+EntriesMap* newEntriesMap(RegionInternal* region,
+                          const RegionAttributes& attrs, Args&&... args) {
+  if (attrs.getValueStorage() == ValueStorageType::OBJECT) {
+    return new TMap(std::forward<Args>(args)...);
+  }
+  return new SerializedEntriesMap<TMap>(region, attrs,
+                                        std::forward<Args>(args)...);
+}
+
+}  // namespace
+
 /**
  * @brief Return a ConcurrentEntriesMap if no LRU, otherwise return a
  * LRUEntriesMap.
@@ -66,15 +81,15 @@ EntriesMap* EntriesMapFactory::createMap(RegionInternal* region,
     }
     if (ttl > std::chrono::seconds::zero() ||
         idle > std::chrono::seconds::zero()) {
-      result = new LRUEntriesMap(
-          &expiryTaskmanager,
+      result = newEntriesMap<LRUEntriesMap>(
+          region, attrs, &expiryTaskmanager,
           std::unique_ptr<LRUExpEntryFactory>(
               new LRUExpEntryFactory(concurrencyChecksEnabled)),
           region, lruEvictionAction, lruLimit, concurrencyChecksEnabled,
           concurrency, heapLRUEnabled);
     } else {
-      result = new LRUEntriesMap(
-          &expiryTaskmanager,
+      result = newEntriesMap<LRUEntriesMap>(
+          region, attrs, &expiryTaskmanager,
           std::unique_ptr<LRUEntryFactory>(
               new LRUEntryFactory(concurrencyChecksEnabled)),
           region, lruEvictionAction, lruLimit, concurrencyChecksEnabled,
@@ -83,15 +98,15 @@ EntriesMap* EntriesMapFactory::createMap(RegionInternal* region,
   } else if (ttl > std::chrono::seconds::zero() ||
              idle > std::chrono::seconds::zero()) {
     // create entries with a ExpEntryFactory.
-    result = new ConcurrentEntriesMap(
-        &expiryTaskmanager,
+    result = newEntriesMap<ConcurrentEntriesMap>(
+        region, attrs, &expiryTaskmanager,
         std::unique_ptr<ExpEntryFactory>(
             new ExpEntryFactory(concurrencyChecksEnabled)),
         concurrencyChecksEnabled, region, concurrency);
   } else {
     // create plain concurrent map.
-    result = new ConcurrentEntriesMap(
-        &expiryTaskmanager,
+    result = newEntriesMap<ConcurrentEntriesMap>(
+        region, attrs, &expiryTaskmanager,
         std::unique_ptr<EntryFactory>(
             new EntryFactory(concurrencyChecksEnabled)),
         concurrencyChecksEnabled, region, concurrency);
@@ -17,10 +17,26 @@
 #include <geode/EntryEvent.hpp>
 
 #include "CacheableToken.hpp"
+#include "LocalRegion.hpp"
+#include "StoredValue.hpp"
 
 namespace apache {
 namespace geode {
 namespace client {
+
+namespace {
+
+void load(const std::shared_ptr<Region>& region,
+          std::shared_ptr<Cacheable>& value) {
+  if (std::dynamic_pointer_cast<StoredValue>(value)) {
+    if (auto localRegion = std::dynamic_pointer_cast<LocalRegion>(region)) {
+      value = localRegion->loadValue(value);
+    }
+  }
+}
+
+}  // namespace
+
 EntryEvent::EntryEvent(const std::shared_ptr<Region>& region,
                        const std::shared_ptr<CacheableKey>& key,
                        const std::shared_ptr<Cacheable>& oldValue,
@@ -36,6 +52,16 @@ EntryEvent::EntryEvent(const std::shared_ptr<Region>& region,
 
 EntryEvent::~EntryEvent() {}
 
+std::shared_ptr<Cacheable> EntryEvent::getOldValue() const {
+  std::call_once(m_oldValueLoaded, [this] { load(m_region, m_oldValue); });
+  return m_oldValue;
+}
+
+std::shared_ptr<Cacheable> EntryEvent::getNewValue() const {
+  std::call_once(m_newValueLoaded, [this] { load(m_region, m_newValue); });
+  return m_newValue;
+}
+
 EntryEvent::EntryEvent()
     /* adongre
      * CID 28923: Uninitialized scalar field (UNINIT_CTOR)
@@ -0,0 +1,143 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_INFLIGHTCALLS_H_
+#define GEODE_INFLIGHTCALLS_H_
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * Lets concurrent callers asking for the same key share a single call.
+ *
+ * The first caller for a key makes the call. Callers arriving while that
+ * call is in progress wait for it and receive a copy of its result, or its
+ * exception. A call for the key made from within the call itself is made
+ * on its own rather than waiting for itself.
+ */
+template <class Key, class Result, class Hash = std::hash<Key>,
+          class KeyEqual = std::equal_to<Key>>
+class InFlightCalls {
+ public:
+  InFlightCalls() = default;
+
+  InFlightCalls(const InFlightCalls&) = delete;
+  InFlightCalls& operator=(const InFlightCalls&) = delete;
+
+  /**
+   * Returns the result of <code>call</code>, or of the call in progress for
+   * <code>key</code>. Sets <code>shared</code> if the result is that of
+   * another caller's call.
+   */
+  template <class Call>
+  Result run(const Key& key, Call call, bool& shared) {
+    shared = false;
+    std::shared_ptr<InFlight> inFlight;
+    bool caller = false;
+    {
+      std::lock_guard<decltype(mutex_)> lock(mutex_);
+      auto it = calls_.find(key);
+      if (it == calls_.end()) {
+        inFlight = std::make_shared<InFlight>();
+        calls_.emplace(key, inFlight);
+        caller = true;
+      } else if (it->second->caller != std::this_thread::get_id()) {
+        inFlight = it->second;
+      }
+    }
+
+    if (!inFlight) {
+      return call();
+    }
+
+    if (caller) {
+      Result result;
+      try {
+        result = call();
+      } catch (...) {
+        complete(key, *inFlight, Result(), std::current_exception());
+        throw;
+      }
+      complete(key, *inFlight, result, nullptr);
+      return result;
+    }
+
+    std::unique_lock<decltype(inFlight->mutex)> lock(inFlight->mutex);
+    inFlight->completed.wait(lock, [&inFlight] { return inFlight->done; });
+    if (inFlight->exception) {
+      std::rethrow_exception(inFlight->exception);
+    }
+    shared = true;
+    return inFlight->result;
+  }
+
+  /**
+   * Returns the number of keys with a call in progress.
+   */
+  size_t size() const {
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+    return calls_.size();
+  }
+
+ private:
+  struct InFlight {
+    InFlight() : caller(std::this_thread::get_id()), done(false) {}
+
+    const std::thread::id caller;
+    std::mutex mutex;
+    std::condition_variable completed;
+    bool done;
+    Result result;
+    std::exception_ptr exception;
+  };
+
+  mutable std::mutex mutex_;
+  std::unordered_map<Key, std::shared_ptr<InFlight>, Hash, KeyEqual> calls_;
+
+  void complete(const Key& key, InFlight& inFlight, Result result,
+                std::exception_ptr exception) {
+    // later callers make a new call rather than taking this result
+    {
+      std::lock_guard<decltype(mutex_)> lock(mutex_);
+      calls_.erase(key);
+    }
+
+    std::lock_guard<decltype(inFlight.mutex)> lock(inFlight.mutex);
+    inFlight.result = std::move(result);
+    inFlight.exception = std::move(exception);
+    inFlight.done = true;
+    inFlight.completed.notify_all();
+  }
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_INFLIGHTCALLS_H_
@@ -0,0 +1,327 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "IoUring.hpp"
+
+#include <cerrno>
+
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#endif
+#endif
+
+// IORING_FEAT_FAST_POLL arrived with the same headers as all operations used
+#if defined(IORING_FEAT_FAST_POLL)
+#define GEODE_HAVE_IO_URING
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <initializer_list>
+#include <thread>
+#endif
+
+#include "util/Log.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+#if defined(GEODE_HAVE_IO_URING)
+
+namespace {
+
+const unsigned ENTRIES = 2;
+
+const uint64_t TRANSFER = 1;
+const uint64_t TIMEOUT = 2;
+
+int io_uring_setup(unsigned entries, io_uring_params* params) {
+  return static_cast<int>(::syscall(__NR_io_uring_setup, entries, params));
+}
+
+int io_uring_enter(int fd, unsigned toSubmit, unsigned minComplete,
+                   unsigned flags) {
+  return static_cast<int>(::syscall(__NR_io_uring_enter, fd, toSubmit,
+                                    minComplete, flags, nullptr, 0));
+}
+
+int io_uring_register(int fd, unsigned opcode, void* arg, unsigned args) {
+  return static_cast<int>(
+      ::syscall(__NR_io_uring_register, fd, opcode, arg, args));
+}
+
+template <class T>
+T* offset(void* base, uint32_t offset) {
+  return reinterpret_cast<T*>(static_cast<char*>(base) + offset);
+}
+
+}  // namespace
+
+/**
+ * The mapped submission and completion queues. Operations are submitted
+ * and reaped by the owning thread only, one transfer at a time.
+ */
+struct IoUring::Ring {
+  int fd;
+  void* rings;
+  size_t ringsSize;
+  io_uring_sqe* sqes;
+  size_t sqesSize;
+
+  std::atomic<unsigned>* sqTail;
+  unsigned sqMask;
+  unsigned* sqArray;
+
+  std::atomic<unsigned>* cqHead;
+  std::atomic<unsigned>* cqTail;
+  unsigned cqMask;
+  io_uring_cqe* cqes;
+
+  Ring()
+      : fd(-1),
+        rings(MAP_FAILED),
+        ringsSize(0),
+        sqes(static_cast<io_uring_sqe*>(MAP_FAILED)),
+        sqesSize(0) {}
+
+  ~Ring() noexcept {
+    if (sqes != MAP_FAILED) {
+      ::munmap(sqes, sqesSize);
+    }
+    if (rings != MAP_FAILED) {
+      ::munmap(rings, ringsSize);
+    }
+    if (fd != -1) {
+      ::close(fd);
+    }
+  }
+
+  bool open() {
+    io_uring_params params;
+    std::memset(&params, 0, sizeof(params));
+    fd = io_uring_setup(ENTRIES, &params);
+    if (fd == -1) {
+      return false;
+    }
+    if (!(params.features & IORING_FEAT_SINGLE_MMAP)) {
+      errno = ENOSYS;
+      return false;
+    }
+
+    ringsSize = std::max(
+        params.sq_off.array + params.sq_entries * sizeof(unsigned),
+        params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe));
+    rings = ::mmap(nullptr, ringsSize, PROT_READ | PROT_WRITE,
+                   MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+    if (rings == MAP_FAILED) {
+      return false;
+    }
+    sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+    sqes = static_cast<io_uring_sqe*>(
+        ::mmap(nullptr, sqesSize, PROT_READ | PROT_WRITE,
+               MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES));
+    if (sqes == MAP_FAILED) {
+      return false;
+    }
+
+    sqTail = offset<std::atomic<unsigned>>(rings, params.sq_off.tail);
+    sqMask = *offset<unsigned>(rings, params.sq_off.ring_mask);
+    sqArray = offset<unsigned>(rings, params.sq_off.array);
+    cqHead = offset<std::atomic<unsigned>>(rings, params.cq_off.head);
+    cqTail = offset<std::atomic<unsigned>>(rings, params.cq_off.tail);
+    cqMask = *offset<unsigned>(rings, params.cq_off.ring_mask);
+    cqes = offset<io_uring_cqe>(rings, params.cq_off.cqes);
+    return true;
+  }
+
+  bool supports(std::initializer_list<int> opcodes) {
+    const auto size = sizeof(io_uring_probe) + 256 * sizeof(io_uring_probe_op);
+    std::unique_ptr<char[]> buffer(new char[size]);
+    std::memset(buffer.get(), 0, size);
+    auto probe = reinterpret_cast<io_uring_probe*>(buffer.get());
+    if (io_uring_register(fd, IORING_REGISTER_PROBE, probe, 256) == -1) {
+      return false;
+    }
+    for (auto opcode : opcodes) {
+      if (opcode > probe->last_op ||
+          !(probe->ops[opcode].flags & IO_URING_OP_SUPPORTED)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /**
+   * Submits the transfer described by the first entry linked to a timeout,
+   * then waits for both to complete. Returns the transfer's result.
+   */
+  int64_t transfer(uint8_t opcode, int handle, const void* buff, size_t len,
+                   std::chrono::microseconds timeout) {
+    const auto seconds =
+        std::chrono::duration_cast<std::chrono::seconds>(timeout);
+    __kernel_timespec expiry;
+    expiry.tv_sec = seconds.count();
+    expiry.tv_nsec =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(timeout - seconds)
+            .count();
+
+    const auto initialTail = sqTail->load(std::memory_order_relaxed);
+    auto tail = initialTail;
+
+    auto sqe = &sqes[tail & sqMask];
+    std::memset(sqe, 0, sizeof(*sqe));
+    sqe->opcode = opcode;
+    sqe->fd = handle;
+    sqe->addr = reinterpret_cast<uint64_t>(buff);
+    sqe->len = static_cast<uint32_t>(len);
+    sqe->msg_flags = MSG_NOSIGNAL;
+    sqe->flags = IOSQE_IO_LINK;
+    sqe->user_data = TRANSFER;
+    sqArray[tail & sqMask] = tail & sqMask;
+    ++tail;
+
+    sqe = &sqes[tail & sqMask];
+    std::memset(sqe, 0, sizeof(*sqe));
+    sqe->opcode = IORING_OP_LINK_TIMEOUT;
+    sqe->fd = -1;
+    sqe->addr = reinterpret_cast<uint64_t>(&expiry);
+    sqe->len = 1;
+    sqe->user_data = TIMEOUT;
+    sqArray[tail & sqMask] = tail & sqMask;
+    ++tail;
+
+    sqTail->store(tail, std::memory_order_release);
+
+    unsigned toSubmit = 2;
+    unsigned pending = 2;
+    int64_t result = -ECANCELED;
+    bool timedOut = false;
+    while (pending > 0) {
+      auto submitted =
+          io_uring_enter(fd, toSubmit, pending, IORING_ENTER_GETEVENTS);
+      if (submitted == -1) {
+        if (errno == EINTR) {
+          continue;
+        } else if (toSubmit == 2) {
+          // nothing was submitted, take the entries back
+          sqTail->store(initialTail, std::memory_order_release);
+          return -1;
+        }
+        // the kernel still uses buff, so completions must be waited for
+        LOGERROR("io_uring_enter failed: %s", std::strerror(errno));
+        std::this_thread::yield();
+        continue;
+      }
+      toSubmit -= std::min(toSubmit, static_cast<unsigned>(submitted));
+
+      auto head = cqHead->load(std::memory_order_relaxed);
+      const auto cqTailValue = cqTail->load(std::memory_order_acquire);
+      for (; head != cqTailValue; ++head, --pending) {
+        const auto& cqe = cqes[head & cqMask];
+        if (cqe.user_data == TRANSFER) {
+          result = cqe.res;
+        } else if (cqe.res == -ETIME) {
+          timedOut = true;
+        }
+      }
+      cqHead->store(head, std::memory_order_release);
+    }
+
+    if (result < 0) {
+      errno = (timedOut && (result == -ECANCELED || result == -EINTR))
+                  ? ETIME
+                  : static_cast<int>(-result);
+      return -1;
+    }
+    return result;
+  }
+};
+
+bool IoUring::isSupported() {
+  static const bool supported = [] {
+    Ring ring;
+    if (!ring.open() ||
+        !ring.supports({IORING_OP_RECV, IORING_OP_SEND,
+                        IORING_OP_LINK_TIMEOUT})) {
+      LOGINFO("io_uring is not available: %s", std::strerror(errno));
+      return false;
+    }
+    return true;
+  }();
+  return supported;
+}
+
+std::unique_ptr<IoUring> IoUring::create() {
+  std::unique_ptr<Ring> ring(new Ring());
+  if (!ring->open()) {
+    LOGWARN("Failed to create io_uring: %s", std::strerror(errno));
+    return nullptr;
+  }
+  return std::unique_ptr<IoUring>(new IoUring(std::move(ring)));
+}
+
+int64_t IoUring::receive(int handle, void* buff, size_t len,
+                         std::chrono::microseconds timeout) {
+  return ring_->transfer(IORING_OP_RECV, handle, buff, len, timeout);
+}
+
+int64_t IoUring::send(int handle, const void* buff, size_t len,
+                      std::chrono::microseconds timeout) {
+  return ring_->transfer(IORING_OP_SEND, handle, buff, len, timeout);
+}
+
+#else
+
+struct IoUring::Ring {};
+
+bool IoUring::isSupported() { return false; }
+
+std::unique_ptr<IoUring> IoUring::create() { return nullptr; }
+
+int64_t IoUring::receive(int, void*, size_t, std::chrono::microseconds) {
+  errno = ENOSYS;
+  return -1;
+}
+
+int64_t IoUring::send(int, const void*, size_t, std::chrono::microseconds) {
+  errno = ENOSYS;
+  return -1;
+}
+
+#endif
+
+IoUring::IoUring(std::unique_ptr<Ring> ring) : ring_(std::move(ring)) {}
+
+IoUring::~IoUring() noexcept = default;
+
+IoUring* IoUring::forThread() {
+  if (!isSupported()) {
+    return nullptr;
+  }
+  static thread_local std::unique_ptr<IoUring> ioUring = create();
+  return ioUring.get();
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
@@ -0,0 +1,88 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_IOURING_H_
+#define GEODE_IOURING_H_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * A small io_uring owned by one thread. Through it TcpConn waits for and
+ * transfers data on a socket with a single system call, the deadline being
+ * enforced by a timeout linked to the transfer.
+ *
+ * Only available on Linux kernels supporting IORING_OP_RECV, IORING_OP_SEND
+ * and IORING_OP_LINK_TIMEOUT, and where io_uring is not disabled, e.g. by a
+ * seccomp profile.
+ */
+class IoUring {
+ public:
+  /**
+   * Returns true if io_uring can be used, probed once per process.
+   */
+  static bool isSupported();
+
+  /**
+   * Returns the calling thread's ring, created on first use, or nullptr if
+   * io_uring can not be used.
+   */
+  static IoUring* forThread();
+
+  ~IoUring() noexcept;
+
+  IoUring(const IoUring&) = delete;
+  IoUring& operator=(const IoUring&) = delete;
+
+  /**
+   * Receives up to <code>len</code> bytes, waiting at most
+   * <code>timeout</code> for any to arrive. Returns the number of bytes
+   * received, 0 if the peer closed the connection, or -1 with errno set,
+   * ETIME if the timeout expired.
+   */
+  int64_t receive(int handle, void* buff, size_t len,
+                  std::chrono::microseconds timeout);
+
+  /**
+   * Sends up to <code>len</code> bytes, like receive.
+   */
+  int64_t send(int handle, const void* buff, size_t len,
+               std::chrono::microseconds timeout);
+
+ private:
+  struct Ring;
+
+  std::unique_ptr<Ring> ring_;
+
+  explicit IoUring(std::unique_ptr<Ring> ring);
+
+  static std::unique_ptr<IoUring> create();
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_IOURING_H_
@@ -253,7 +253,7 @@ GfErrType LRUEntriesMap::invalidate(const std::shared_ptr<CacheableKey>& key,
 }
 
 GfErrType LRUEntriesMap::put(const std::shared_ptr<CacheableKey>& key,
-                             const std::shared_ptr<Cacheable>& newValue,
+                             std::shared_ptr<Cacheable>& newValue,
                              std::shared_ptr<MapEntryImpl>& me,
                              std::shared_ptr<Cacheable>& oldValue,
                              int updateCount, int destroyTracker,
@@ -81,7 +81,7 @@ class APACHE_GEODE_EXPORT LRUEntriesMap : public ConcurrentEntriesMap {
   virtual ~LRUEntriesMap();
 
   virtual GfErrType put(const std::shared_ptr<CacheableKey>& key,
-                        const std::shared_ptr<Cacheable>& newValue,
+                        std::shared_ptr<Cacheable>& newValue,
                         std::shared_ptr<MapEntryImpl>& me,
                         std::shared_ptr<Cacheable>& oldValue, int updateCount,
                         int destroyTracker,
@@ -17,6 +17,10 @@
 
 #include "LocalRegion.hpp"
 
+#include <algorithm>
+#include <deque>
+#include <exception>
+#include <mutex>
 #include <sstream>
 #include <vector>
 
@@ -29,21 +33,171 @@
 #include "EntryExpiryHandler.hpp"
 #include "ExpiryTaskManager.hpp"
 #include "LRUEntriesMap.hpp"
+#include "PutAllPartialResult.hpp"
 #include "RegionExpiryHandler.hpp"
 #include "RegionGlobalLocks.hpp"
 #include "SerializableHelper.hpp"
 #include "TXState.hpp"
 #include "TcrConnectionManager.hpp"
+#include "ThreadPool.hpp"
+#include "UserAttributes.hpp"
 #include "Utils.hpp"
 #include "VersionTag.hpp"
 #include "util/Log.hpp"
 #include "util/bounds.hpp"
+#include "util/chrono/coarse_clock.hpp"
 #include "util/exception.hpp"
 
 namespace apache {
 namespace geode {
 namespace client {
 
+void setThreadLocalExceptionMessage(std::string exMsg);
+const std::string& getThreadLocalExceptionMessage();
+
+namespace {
+
+/**
+ * One sub-batch of a split bulk operation, run as the user of the thread
+ * that started the operation.
+ */
+class BulkOpBatch : public PooledWork<GfErrType> {
+ public:
+  BulkOpBatch(std::function<GfErrType()> batch,
+              std::shared_ptr<UserAttributes> userAttr)
+      : m_batch(std::move(batch)), m_userAttr(std::move(userAttr)) {}
+
+  /** Returns the exception thrown by the batch, if any. */
+  std::exception_ptr exception() const { return m_exception; }
+
+  /** Returns the message describing the error of the batch, if any. */
+  const std::string& exceptionMessage() const { return m_exceptionMessage; }
+
+ protected:
+  GfErrType execute() override {
+    GuardUserAttributes gua;
+    if (m_userAttr) {
+      gua.setAuthenticatedView(m_userAttr->getAuthenticatedView());
+    }
+
+    GfErrType err;
+    try {
+      err = m_batch();
+    } catch (...) {
+      m_exception = std::current_exception();
+      err = GF_EUNDEF;
+    }
+    // the message is left by the failed operation on this pool thread
+    if (err != GF_NOERR) {
+      m_exceptionMessage = getThreadLocalExceptionMessage();
+    }
+    setThreadLocalExceptionMessage("");
+    return err;
+  }
+
+ private:
+  std::function<GfErrType()> m_batch;
+  std::shared_ptr<UserAttributes> m_userAttr;
+  std::exception_ptr m_exception;
+  std::string m_exceptionMessage;
+};
+
+/**
+ * Merges the succeeded keys and version tags of the sub-batches of a split
+ * putAll or removeAll into one result, as singlehop operations merge the
+ * results of each server.
+ */
+class BulkOpResults {
+ public:
+  explicit BulkOpResults(size_t size)
+      : m_size(size),
+        m_result(std::make_shared<PutAllPartialResult>(static_cast<int>(size),
+                                                       m_responseLock)),
+        m_hasLists(false),
+        m_succeeded(0) {}
+
+  /**
+   * Adds the result of a sub-batch that sent <code>keys</code>, in this
+   * order.
+   */
+  void add(GfErrType err,
+           const std::vector<std::shared_ptr<CacheableKey>>& keys,
+           const std::shared_ptr<VersionedCacheableObjectPartList>& list) {
+    std::lock_guard<decltype(m_mutex)> guard(m_mutex);
+    if (err != GF_NOERR && !keys.empty()) {
+      m_result->saveFailedKey(keys.front(), nullptr);
+    }
+    m_hasLists |= list != nullptr;
+
+    auto succeeded = list;
+    if (!succeeded || !succeeded->getSucceededKeys() ||
+        succeeded->getSucceededKeys()->empty()) {
+      if (err != GF_NOERR) {
+        return;
+      }
+      // multiple hop replies carry the tags of the keys in the order sent
+      succeeded = std::make_shared<VersionedCacheableObjectPartList>(
+          std::make_shared<std::vector<std::shared_ptr<CacheableKey>>>(keys),
+          m_responseLock);
+      if (list) {
+        succeeded->setVersionedTagptr(list->getVersionedTagptr());
+      }
+    }
+
+    // keep a tag, if only nullptr, for every key once any key has one
+    auto merged = m_result->getSucceededKeysAndVersions();
+    auto& mergedTags = merged->getVersionedTagptr();
+    auto& tags = succeeded->getVersionedTagptr();
+    if (!tags.empty() || !mergedTags.empty()) {
+      mergedTags.resize(merged->getSucceededKeys()->size());
+      tags.resize(succeeded->getSucceededKeys()->size());
+    }
+    m_result->addKeysAndVersions(succeeded);
+    m_succeeded += succeeded->getSucceededKeys()->size();
+  }
+
+  /**
+   * Returns the merged succeeded keys and version tags, or nullptr if no
+   * sub-batch returned any because the region has no server.
+   */
+  std::shared_ptr<VersionedCacheableObjectPartList> getList() const {
+    return m_hasLists ? m_result->getSucceededKeysAndVersions() : nullptr;
+  }
+
+  /**
+   * Describes which part of the operation failed, ahead of
+   * <code>cause</code>, the message of the first failed sub-batch.
+   */
+  std::string describeFailure(const std::string& operation,
+                              const std::string& cause) const {
+    auto message = "The " + operation + " operation failed for " +
+                   std::to_string(m_size - m_succeeded) + " out of " +
+                   std::to_string(m_size) + " entries";
+    if (auto key = m_result->getFirstFailedKey()) {
+      message += ", the first failed batch starts at key " + key->toString();
+    }
+    if (!cause.empty()) {
+      message += ": " + cause;
+    }
+    return message;
+  }
+
+ private:
+  const size_t m_size;
+  std::recursive_mutex m_responseLock;
+  std::shared_ptr<PutAllPartialResult> m_result;
+  std::mutex m_mutex;
+  bool m_hasLists;
+  size_t m_succeeded;
+};
+
+bool isMissing(const std::shared_ptr<Cacheable>& value) {
+  return value == nullptr || CacheableToken::isInvalid(value) ||
+         CacheableToken::isTombstone(value);
+}
+
+}  // namespace
+
 LocalRegion::LocalRegion(const std::string& name, CacheImpl* cacheImpl,
                          const std::shared_ptr<RegionInternal>& rPtr,
                          RegionAttributes attributes,
@@ -63,6 +217,18 @@ LocalRegion::LocalRegion(const std::string& name, CacheImpl* cacheImpl,
       m_isPRSingleHopEnabled(false),
       m_attachedPool(nullptr),
       m_enableTimeStatistics(enableTimeStatistics),
+      m_coarseTimeStatistics(cacheImpl->getDistributedSystem()
+                                 .getSystemProperties()
+                                 .getCoarseTimeStatistics()),
+      m_bulkOpBatchSize(cacheImpl->getDistributedSystem()
+                            .getSystemProperties()
+                            .bulkOpBatchSize()),
+      m_bulkOpBatchesInFlight(cacheImpl->getDistributedSystem()
+                                  .getSystemProperties()
+                                  .bulkOpBatchesInFlight()),
+      m_coalesceCacheLoads(cacheImpl->getDistributedSystem()
+                               .getSystemProperties()
+                               .cacheLoaderCoalescingEnabled()),
       m_persistenceManager(nullptr) {
   if (m_parentRegion != nullptr) {
     ((m_fullPath = m_parentRegion->getFullPath()) += "/") += m_name;
@@ -95,6 +261,12 @@ LocalRegion::LocalRegion(const std::string& name, CacheImpl* cacheImpl,
       cacheImpl->getStatisticsManager().getStatisticsFactory(), m_fullPath);
   auto p = cacheImpl->getPoolManager().find(getAttributes().getPoolName());
   setPool(p);
+
+  if (regionExpiryEnabled() || entryExpiryEnabled() ||
+      (m_enableTimeStatistics && m_coarseTimeStatistics)) {
+    m_coarseClockTicker = std::unique_ptr<util::chrono::coarse_clock_ticker>(
+        new util::chrono::coarse_clock_ticker());
+  }
 }
 
 const std::string& LocalRegion::getName() const { return m_name; }
@@ -109,14 +281,18 @@ std::shared_ptr<Region> LocalRegion::getParentRegion() const {
 void LocalRegion::updateAccessAndModifiedTime(bool modified) {
   // locking not required since setters use atomic operations
   if (regionExpiryEnabled()) {
-    auto now = std::chrono::system_clock::now();
-    auto timeStr = to_string(now.time_since_epoch());
-    LOGDEBUG("Setting last accessed time for region %s to %s",
-             getFullPath().c_str(), timeStr.c_str());
+    auto now = util::chrono::coarse_system_clock::now();
+    if (Log::debugEnabled()) {
+      auto timeStr = to_string(now.time_since_epoch());
+      LOGDEBUG("Setting last accessed time for region %s to %s",
+               getFullPath().c_str(), timeStr.c_str());
+      if (modified) {
+        LOGDEBUG("Setting last modified time for region %s to %s",
+                 getFullPath().c_str(), timeStr.c_str());
+      }
+    }
     m_cacheStatistics->setLastAccessedTime(now);
     if (modified) {
-      LOGDEBUG("Setting last modified time for region %s to %s",
-               getFullPath().c_str(), timeStr.c_str());
       m_cacheStatistics->setLastModifiedTime(now);
     }
     // TODO:  should we really touch the parent region??
@@ -281,6 +457,7 @@ std::shared_ptr<Region> LocalRegion::createSubregion(
 
   rPtr->acquireReadLock();
   m_subRegions.emplace(rPtr->getName(), rPtr);
+  m_cacheImpl->clearRegionHandles();
 
   // schedule the sub region expiry if regionExpiry enabled.
   rPtr->setRegionExpiryTask();
@@ -385,7 +562,7 @@ void LocalRegion::removeAll(
     throw IllegalArgumentException("Region::removeAll: zero keys provided");
   }
   int64_t sampleStartNanos = startStatOpTime();
-  GfErrType err = removeAllNoThrow(keys, aCallbackArgument);
+  auto err = removeAllNoThrow(keys, aCallbackArgument);
   updateStatOpTime(m_regionStats->getStat(),
                    m_regionStats->getRemoveAllTimeId(), sampleStartNanos);
   throwExceptionIfError("Region::removeAll", err);
@@ -577,8 +754,26 @@ HashMapOfCacheable LocalRegion::getAll_internal(
 
   auto values = std::make_shared<HashMapOfCacheable>();
   auto exceptions = std::make_shared<HashMapOfException>();
-  GfErrType err = getAllNoThrow(keys, values, exceptions, addToLocalCache,
-                                aCallbackArgument);
+  GfErrType err;
+  if (splitBulkOp(keys.size())) {
+    std::mutex resultsMutex;
+    err = runBulkOpBatches(keys.size(), [&](size_t begin, size_t end) {
+      std::vector<std::shared_ptr<CacheableKey>> subKeys(keys.begin() + begin,
+                                                         keys.begin() + end);
+      auto subValues = std::make_shared<HashMapOfCacheable>();
+      auto subExceptions = std::make_shared<HashMapOfException>();
+      auto subErr = getAllNoThrow(subKeys, subValues, subExceptions,
+                                  addToLocalCache, aCallbackArgument);
+
+      std::lock_guard<decltype(resultsMutex)> guard(resultsMutex);
+      values->insert(subValues->begin(), subValues->end());
+      exceptions->insert(subExceptions->begin(), subExceptions->end());
+      return subErr;
+    });
+  } else {
+    err = getAllNoThrow(keys, values, exceptions, addToLocalCache,
+                        aCallbackArgument);
+  }
 
   updateStatOpTime(m_regionStats->getStat(), m_regionStats->getGetAllTimeId(),
                    sampleStartNanos);
@@ -588,6 +783,118 @@ HashMapOfCacheable LocalRegion::getAll_internal(
   return *values;
 }
 
+bool LocalRegion::splitBulkOp(size_t size) const {
+  // the transaction state is bound to the calling thread
+  return m_bulkOpBatchSize > 0 && size > m_bulkOpBatchSize &&
+         getTXState() == nullptr;
+}
+
+GfErrType LocalRegion::runBulkOpBatches(
+    size_t size, const std::function<GfErrType(size_t, size_t)>& batch) {
+  auto& threadPool = m_cacheImpl->getThreadPool();
+  auto userAttr = UserAttributes::threadLocalUserAttributes;
+  const size_t inFlight = std::max<size_t>(m_bulkOpBatchesInFlight, 1);
+
+  GfErrType err = GF_NOERR;
+  std::exception_ptr exception;
+  std::deque<std::shared_ptr<BulkOpBatch>> batches;
+  auto join = [&]() {
+    auto oldest = std::move(batches.front());
+    batches.pop_front();
+    auto batchErr = oldest->getResult();
+    if (err == GF_NOERR && batchErr != GF_NOERR) {
+      err = batchErr;
+      exception = oldest->exception();
+      setThreadLocalExceptionMessage(oldest->exceptionMessage());
+    }
+  };
+
+  for (size_t begin = 0; begin < size && err == GF_NOERR;
+       begin += m_bulkOpBatchSize) {
+    if (batches.size() >= inFlight) {
+      join();
+      if (err != GF_NOERR) {
+        break;
+      }
+    }
+
+    auto end = std::min(size, begin + m_bulkOpBatchSize);
+    auto work = std::make_shared<BulkOpBatch>(
+        [&batch, begin, end]() { return batch(begin, end); }, userAttr);
+    threadPool.perform(work);
+    batches.push_back(std::move(work));
+  }
+
+  while (!batches.empty()) {
+    join();
+  }
+
+  if (exception) {
+    std::rethrow_exception(exception);
+  }
+  return err;
+}
+
+GfErrType LocalRegion::putAllNoThrow_remoteBatches(
+    const HashMapOfCacheable& map,
+    std::shared_ptr<VersionedCacheableObjectPartList>& versionedObjPartList,
+    std::chrono::milliseconds timeout,
+    const std::shared_ptr<Serializable>& aCallbackArgument) {
+  std::vector<HashMapOfCacheable::const_iterator> entries;
+  entries.reserve(map.size());
+  for (auto it = map.begin(); it != map.end(); ++it) {
+    entries.push_back(it);
+  }
+
+  BulkOpResults results(map.size());
+  auto err = runBulkOpBatches(map.size(), [&](size_t begin, size_t end) {
+    HashMapOfCacheable subMap(end - begin);
+    for (auto i = begin; i < end; ++i) {
+      subMap.emplace(entries[i]->first, entries[i]->second);
+    }
+    std::shared_ptr<VersionedCacheableObjectPartList> subList;
+    auto subErr =
+        putAllNoThrow_remote(subMap, subList, timeout, aCallbackArgument);
+
+    std::vector<std::shared_ptr<CacheableKey>> sentKeys;
+    sentKeys.reserve(subMap.size());
+    for (const auto& entry : subMap) {
+      sentKeys.push_back(entry.first);
+    }
+    results.add(subErr, sentKeys, subList);
+    return subErr;
+  });
+
+  if (err != GF_NOERR) {
+    setThreadLocalExceptionMessage(
+        results.describeFailure("putAll", getThreadLocalExceptionMessage()));
+  }
+  versionedObjPartList = results.getList();
+  return err;
+}
+
+GfErrType LocalRegion::removeAllNoThrow_remoteBatches(
+    const std::vector<std::shared_ptr<CacheableKey>>& keys,
+    std::shared_ptr<VersionedCacheableObjectPartList>& versionedObjPartList,
+    const std::shared_ptr<Serializable>& aCallbackArgument) {
+  BulkOpResults results(keys.size());
+  auto err = runBulkOpBatches(keys.size(), [&](size_t begin, size_t end) {
+    std::vector<std::shared_ptr<CacheableKey>> subKeys(keys.begin() + begin,
+                                                       keys.begin() + end);
+    std::shared_ptr<VersionedCacheableObjectPartList> subList;
+    auto subErr = removeAllNoThrow_remote(subKeys, subList, aCallbackArgument);
+    results.add(subErr, subKeys, subList);
+    return subErr;
+  });
+
+  if (err != GF_NOERR) {
+    setThreadLocalExceptionMessage(
+        results.describeFailure("removeAll", getThreadLocalExceptionMessage()));
+  }
+  versionedObjPartList = results.getList();
+  return err;
+}
+
 uint32_t LocalRegion::size_remote() {
   CHECK_DESTROY_PENDING(TryReadGuard, LocalRegion::size);
   if (m_regionAttributes.getCachingEnabled()) {
@@ -780,6 +1087,7 @@ void LocalRegion::release(bool invokeCallbacks) {
   if (m_entries != nullptr && m_regionAttributes.getCachingEnabled()) {
     m_entries->close();
   }
+  m_coarseClockTicker = nullptr;
   LOGFINE("LocalRegion::release done for region %s", m_fullPath.c_str());
 }
 
@@ -848,6 +1156,7 @@ GfErrType LocalRegion::getNoThrow(
     if (err == GF_NOERR) {
       txState->setDirty();
     }
+    value = loadValue(value);
     if (CacheableToken::isInvalid(value) ||
         CacheableToken::isTombstone(value)) {
       value = nullptr;
@@ -919,33 +1228,27 @@ GfErrType LocalRegion::getNoThrow(
   cachePerfStats.incMisses();
   std::shared_ptr<VersionTag> versionTag;
   // Get from some remote source (e.g. external java server) if required.
-  err = getNoThrow_remote(keyPtr, value, aCallbackArgument, versionTag);
+  // A shared fetch may predate the update tracking of this thread, so only
+  // the version checks of putLocal keep it from replacing a newer value.
+  if (cachingEnabled && aCallbackArgument == nullptr &&
+      m_regionAttributes.getConcurrencyChecksEnabled()) {
+    err = getNoThrow_coalesced(keyPtr, value, versionTag, isLoaderInvoked);
+  } else {
+    err = getNoThrow_remote(keyPtr, value, aCallbackArgument, versionTag);
+  }
 
   // Its a cache missor it is invalid token then Check if we have a local
   // loader.
-  if ((value == nullptr || CacheableToken::isInvalid(value) ||
-       CacheableToken::isTombstone(value)) &&
-      m_loader != nullptr) {
-    try {
-      isLoaderInvoked = true;
-      /*Update the statistics*/
-      int64_t sampleStartNanos = startStatOpTime();
-      value = m_loader->load(*this, keyPtr, aCallbackArgument);
-      updateStatOpTime(m_regionStats->getStat(),
-                       m_regionStats->getLoaderCallTimeId(), sampleStartNanos);
-      m_regionStats->incLoaderCallsCompleted();
-    } catch (const Exception& ex) {
-      LOGERROR("Error in CacheLoader::load: %s: %s", ex.getName().c_str(),
-               ex.what());
-      err = GF_CACHE_LOADER_EXCEPTION;
-    } catch (...) {
-      LOGERROR("Error in CacheLoader::load, unknown");
-      err = GF_CACHE_LOADER_EXCEPTION;
-    }
-    if (err != GF_NOERR) {
-      return err;
+  if (!isLoaderInvoked && isMissing(value) && m_loader != nullptr) {
+    isLoaderInvoked = true;
+    auto loaderErr = loadNoThrow(keyPtr, value, aCallbackArgument);
+    if (loaderErr != GF_NOERR) {
+      err = loaderErr;
     }
   }
+  if (isLoaderInvoked && err != GF_NOERR) {
+    return err;
+  }
 
   std::shared_ptr<Cacheable> oldValue;
   // Found it somehow, so store it.
@@ -972,6 +1275,7 @@ GfErrType LocalRegion::getNoThrow(
             CacheableToken::isTombstone(value)) {
           value = nullptr;
         }
+        value = loadValue(value);
         // don't do anything and  exit
         return GF_NOERR;
       }
@@ -991,6 +1295,8 @@ GfErrType LocalRegion::getNoThrow(
   if (CacheableToken::isInvalid(value) || CacheableToken::isTombstone(value)) {
     value = nullptr;
   }
+  // a value received or displaced in serialized form is read now
+  value = loadValue(value);
 
   // invokeCacheListenerForEntryEvent method has the check that if oldValue
   // is a CacheableToken then it sets it to nullptr; also determines if it
@@ -1005,6 +1311,60 @@ GfErrType LocalRegion::getNoThrow(
   return err;
 }
 
+GfErrType LocalRegion::getNoThrow_coalesced(
+    const std::shared_ptr<CacheableKey>& keyPtr,
+    std::shared_ptr<Cacheable>& value, std::shared_ptr<VersionTag>& versionTag,
+    bool& isLoaderInvoked) {
+  bool coalesced = false;
+  auto missedGet = m_inFlightGets.run(
+      keyPtr,
+      [&]() {
+        MissedGet fetched;
+        fetched.err = getNoThrow_remote(keyPtr, fetched.value, nullptr,
+                                        fetched.versionTag);
+        if (m_coalesceCacheLoads && isMissing(fetched.value) &&
+            m_loader != nullptr) {
+          fetched.loaderInvoked = true;
+          auto loaderErr = loadNoThrow(keyPtr, fetched.value, nullptr);
+          if (loaderErr != GF_NOERR) {
+            fetched.err = loaderErr;
+          }
+        }
+        return fetched;
+      },
+      coalesced);
+  if (coalesced) {
+    m_regionStats->incCoalescedGets();
+  }
+
+  value = missedGet.value;
+  versionTag = missedGet.versionTag;
+  isLoaderInvoked = missedGet.loaderInvoked;
+  return missedGet.err;
+}
+
+GfErrType LocalRegion::loadNoThrow(
+    const std::shared_ptr<CacheableKey>& keyPtr,
+    std::shared_ptr<Cacheable>& value,
+    const std::shared_ptr<Serializable>& aCallbackArgument) {
+  try {
+    /*Update the statistics*/
+    int64_t sampleStartNanos = startStatOpTime();
+    value = m_loader->load(*this, keyPtr, aCallbackArgument);
+    updateStatOpTime(m_regionStats->getStat(),
+                     m_regionStats->getLoaderCallTimeId(), sampleStartNanos);
+    m_regionStats->incLoaderCallsCompleted();
+  } catch (const Exception& ex) {
+    LOGERROR("Error in CacheLoader::load: %s: %s", ex.getName().c_str(),
+             ex.what());
+    return GF_CACHE_LOADER_EXCEPTION;
+  } catch (...) {
+    LOGERROR("Error in CacheLoader::load, unknown");
+    return GF_CACHE_LOADER_EXCEPTION;
+  }
+  return GF_NOERR;
+}
+
 GfErrType LocalRegion::getAllNoThrow(
     const std::vector<std::shared_ptr<CacheableKey>>& keys,
     const std::shared_ptr<HashMapOfCacheable>& values,
@@ -1976,9 +2336,17 @@ GfErrType LocalRegion::putAllNoThrow(
       }
     }
   }
-  // try remote putAll, if any
-  if ((err = putAllNoThrow_remote(map, versionedObjPartListPtr, timeout,
-                                  aCallbackArgument)) != GF_NOERR) {
+  // try remote putAll, if any; large ones in sub-batches on the thread pool,
+  // while writers and listeners are invoked on this thread
+  const auto batched = splitBulkOp(map.size());
+  if (batched) {
+    err = putAllNoThrow_remoteBatches(map, versionedObjPartListPtr, timeout,
+                                      aCallbackArgument);
+  } else {
+    err = putAllNoThrow_remote(map, versionedObjPartListPtr, timeout,
+                               aCallbackArgument);
+  }
+  if (err != GF_NOERR) {
     return err;
   }
   // next the local puts
@@ -1986,8 +2354,9 @@ GfErrType LocalRegion::putAllNoThrow(
   std::shared_ptr<VersionTag> versionTag;
 
   if (cachingEnabled) {
-    if (m_isPRSingleHopEnabled) { /*New PRSingleHop Case:: PR Singlehop
-                                     condition*/
+    // singlehop and split putAlls name the keys that succeeded
+    if (batched ? versionedObjPartListPtr != nullptr
+                : m_isPRSingleHopEnabled) {
       for (size_t keyIndex = 0;
            keyIndex < versionedObjPartListPtr->getSucceededKeys()->size();
            keyIndex++) {
@@ -2100,9 +2469,15 @@ GfErrType LocalRegion::removeAllNoThrow(
   // 3.add tracking
   bool cachingEnabled = m_regionAttributes.getCachingEnabled();
 
-  // 4. do remote removeAll
-  err =
-      removeAllNoThrow_remote(keys, versionedObjPartListPtr, aCallbackArgument);
+  // 4. do remote removeAll, large ones in sub-batches on the thread pool
+  const auto batched = splitBulkOp(keys.size());
+  if (batched) {
+    err = removeAllNoThrow_remoteBatches(keys, versionedObjPartListPtr,
+                                         aCallbackArgument);
+  } else {
+    err = removeAllNoThrow_remote(keys, versionedObjPartListPtr,
+                                  aCallbackArgument);
+  }
   if (err != GF_NOERR) {
     return err;
   }
@@ -2112,7 +2487,8 @@ GfErrType LocalRegion::removeAllNoThrow(
   std::shared_ptr<VersionTag> versionTag;
   if (cachingEnabled) {
     std::vector<std::shared_ptr<CacheableKey>>* keysPtr;
-    if (m_isPRSingleHopEnabled) {
+    if (batched ? versionedObjPartListPtr != nullptr
+                : m_isPRSingleHopEnabled) {
       keysPtr = versionedObjPartListPtr->getSucceededKeys().get();
     } else {
       keysPtr = const_cast<std::vector<std::shared_ptr<CacheableKey>>*>(&keys);
@@ -2404,6 +2780,7 @@ GfErrType LocalRegion::destroyRegionNoThrow(
     }
   }
   m_subRegions.clear();
+  m_cacheImpl->clearRegionHandles();
 
   //  for the expiry case try the local destroy first and remote
   // destroy only if local destroy succeeds
@@ -2462,13 +2839,14 @@ GfErrType LocalRegion::putLocal(const std::string& name, bool isCreate,
       err = m_entries->create(key, value, entry, oldValue, updateCount,
                               destroyTracker, versionTag);
     } else {
-      err = m_entries->put(key, value, entry, oldValue, updateCount,
+      // a delta is applied to the value in place
+      std::shared_ptr<Cacheable>& newValue1 =
+          const_cast<std::shared_ptr<Cacheable>&>(value);
+      err = m_entries->put(key, newValue1, entry, oldValue, updateCount,
                            destroyTracker, versionTag, isUpdate, delta);
       if (err == GF_INVALID_DELTA) {
         cachePerfStats.incFailureOnDeltaReceived();
         // PXR: Get full object from server.
-        std::shared_ptr<Cacheable>& newValue1 =
-            const_cast<std::shared_ptr<Cacheable>&>(value);
         std::shared_ptr<VersionTag> versionTag1;
         err = getNoThrow_FullObject(eventId, newValue1, versionTag1);
         if (err == GF_NOERR && newValue1 != nullptr) {
@@ -2754,7 +3132,7 @@ GfErrType LocalRegion::invokeCacheListenerForRegionEvent(
     try {
       bool updateStats = true;
       /*Update the CacheWriter Stats*/
-      int64_t sampleStartNanos = Utils::startStatOpTime();
+      int64_t sampleStartNanos = startStatOpTime();
       switch (type) {
         case AFTER_REGION_DESTROY: {
           eventStr = "afterRegionDestroy";
@@ -2810,21 +3188,21 @@ void LocalRegion::updateAccessAndModifiedTimeForEntry(
   // locking is not required since setters use atomic operations
   if (ptr != nullptr && entryExpiryEnabled()) {
     ExpEntryProperties& expProps = ptr->getExpProperties();
-    auto currTime = std::chrono::system_clock::now();
-    std::string keyStr;
+    auto currTime = util::chrono::coarse_system_clock::now();
     if (Log::debugEnabled()) {
       std::shared_ptr<CacheableKey> key;
       ptr->getKeyI(key);
-      keyStr = Utils::nullSafeToString(key);
+      auto keyStr = Utils::nullSafeToString(key);
+      auto timeStr = to_string(currTime.time_since_epoch());
+      LOGDEBUG("Setting last accessed time for key [%s] in region %s to %s",
+               keyStr.c_str(), getFullPath().c_str(), timeStr.c_str());
+      if (modified) {
+        LOGDEBUG("Setting last modified time for key [%s] in region %s to %s",
+                 keyStr.c_str(), getFullPath().c_str(), timeStr.c_str());
+      }
     }
-    LOGDEBUG("Setting last accessed time for key [%s] in region %s to %s",
-             keyStr.c_str(), getFullPath().c_str(),
-             to_string(currTime.time_since_epoch()).c_str());
     expProps.updateLastAccessTime(currTime);
     if (modified) {
-      LOGDEBUG("Setting last modified time for key [%s] in region %s to %s",
-               keyStr.c_str(), getFullPath().c_str(),
-               to_string(currTime.time_since_epoch()).c_str());
       expProps.updateLastModifiedTime(currTime);
     }
   }
@@ -3184,12 +3562,19 @@ std::shared_ptr<TombstoneList> LocalRegion::getTombstoneList() {
 }
 
 int64_t LocalRegion::startStatOpTime() {
-  return m_enableTimeStatistics ? Utils::startStatOpTime() : 0;
+  if (!m_enableTimeStatistics) {
+    return 0;
+  } else if (m_coarseTimeStatistics) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               util::chrono::coarse_steady_clock::now().time_since_epoch())
+        .count();
+  }
+  return Utils::startStatOpTime();
 }
 void LocalRegion::updateStatOpTime(Statistics* statistics, int32_t statId,
                                    int64_t start) {
   if (m_enableTimeStatistics) {
-    Utils::updateStatOpTime(statistics, statId, start);
+    statistics->incLong(statId, startStatOpTime() - start);
   }
 }
 
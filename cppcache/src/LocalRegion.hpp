@@ -20,6 +20,7 @@
 #ifndef GEODE_LOCALREGION_H_
 #define GEODE_LOCALREGION_H_
 
+#include <functional>
 #include <string>
 #include <unordered_map>
 
@@ -37,17 +38,21 @@
 #include <geode/RegionEntry.hpp>
 #include <geode/RegionEvent.hpp>
 #include <geode/Serializable.hpp>
+#include <geode/internal/functional.hpp>
 #include <geode/internal/geode_globals.hpp>
 
 #include "CacheableToken.hpp"
 #include "EntriesMapFactory.hpp"
 #include "EventType.hpp"
 #include "ExpMapEntry.hpp"
+#include "InFlightCalls.hpp"
+#include "ReadWriteLock.hpp"
 #include "RegionInternal.hpp"
 #include "RegionStats.hpp"
 #include "SerializationRegistry.hpp"
 #include "TSSTXStateWrapper.hpp"
 #include "TombstoneList.hpp"
+#include "util/chrono/coarse_clock.hpp"
 #include "util/synchronized_map.hpp"
 
 namespace apache {
@@ -352,8 +357,8 @@ class APACHE_GEODE_EXPORT LocalRegion : public RegionInternal {
                             std::shared_ptr<VersionTag> versionTag);
 
   void setRegionExpiryTask() override;
-  void acquireReadLock() override { m_rwLock.acquire_read(); }
-  void releaseReadLock() override { m_rwLock.release(); }
+  void acquireReadLock() override { m_rwLock.lock_shared(); }
+  void releaseReadLock() override { m_rwLock.unlock_shared(); }
 
   // behaviors for attributes mutator
   uint32_t adjustLruEntriesLimit(uint32_t limit) override;
@@ -403,6 +408,24 @@ class APACHE_GEODE_EXPORT LocalRegion : public RegionInternal {
 
   EntriesMap* getEntryMap() { return m_entries; }
 
+  /**
+   * Whether values received from the server are kept in the serialized form
+   * they arrived in until they are read, see ValueStorageType.
+   */
+  bool storesSerializedValues() const {
+    return m_entries != nullptr &&
+           m_regionAttributes.getValueStorage() != ValueStorageType::OBJECT;
+  }
+
+  /**
+   * Returns the object form of a value that may still be in the serialized
+   * form it was received or stored in.
+   */
+  std::shared_ptr<Cacheable> loadValue(
+      const std::shared_ptr<Cacheable>& value) const {
+    return m_entries != nullptr ? m_entries->load(value) : value;
+  }
+
   std::shared_ptr<TombstoneList> getTombstoneList() override;
 
  protected:
@@ -497,6 +520,41 @@ class APACHE_GEODE_EXPORT LocalRegion : public RegionInternal {
       const CacheEventFlags eventFlags, std::shared_ptr<VersionTag> versionTag,
       DataInput* delta = nullptr, std::shared_ptr<EventId> eventId = nullptr);
 
+  /**
+   * Returns true if a bulk operation on <code>size</code> entries is to be
+   * split into sub-batches of at most m_bulkOpBatchSize entries.
+   */
+  bool splitBulkOp(size_t size) const;
+
+  /**
+   * Runs <code>batch</code> for consecutive ranges of at most
+   * m_bulkOpBatchSize of the <code>size</code> entries on the cache's thread
+   * pool, with at most m_bulkOpBatchesInFlight ranges running at a time. No
+   * further ranges are started once a batch fails. Returns the error of the
+   * first failed batch, or rethrows its exception.
+   */
+  GfErrType runBulkOpBatches(
+      size_t size, const std::function<GfErrType(size_t, size_t)>& batch);
+
+  /**
+   * Sends a putAll in sub-batches, see runBulkOpBatches, and merges their
+   * succeeded keys and version tags into <code>versionedObjPartList</code>.
+   * Writers and listeners are left to the calling thread.
+   */
+  GfErrType putAllNoThrow_remoteBatches(
+      const HashMapOfCacheable& map,
+      std::shared_ptr<VersionedCacheableObjectPartList>& versionedObjPartList,
+      std::chrono::milliseconds timeout,
+      const std::shared_ptr<Serializable>& aCallbackArgument);
+
+  /**
+   * Sends a removeAll in sub-batches, like putAllNoThrow_remoteBatches.
+   */
+  GfErrType removeAllNoThrow_remoteBatches(
+      const std::vector<std::shared_ptr<CacheableKey>>& keys,
+      std::shared_ptr<VersionedCacheableObjectPartList>& versionedObjPartList,
+      const std::shared_ptr<Serializable>& aCallbackArgument);
+
   int64_t startStatOpTime();
   void updateStatOpTime(Statistics* m_regionStats, int32_t statId,
                         int64_t start);
@@ -521,8 +579,33 @@ class APACHE_GEODE_EXPORT LocalRegion : public RegionInternal {
   bool m_isPRSingleHopEnabled;
   std::shared_ptr<Pool> m_attachedPool;
   bool m_enableTimeStatistics;
+  bool m_coarseTimeStatistics;
+  // keeps the coarse clocks ticking while expiry or statistics read them
+  std::unique_ptr<util::chrono::coarse_clock_ticker> m_coarseClockTicker;
+  uint32_t m_bulkOpBatchSize;
+  uint32_t m_bulkOpBatchesInFlight;
 
-  mutable ACE_RW_Thread_Mutex m_rwLock;
+  /**
+   * The value of a key missing from the local cache, as fetched from the
+   * server or else the loader.
+   */
+  struct MissedGet {
+    MissedGet() : err(GF_NOERR), loaderInvoked(false) {}
+
+    GfErrType err;
+    std::shared_ptr<Cacheable> value;
+    std::shared_ptr<VersionTag> versionTag;
+    bool loaderInvoked;
+  };
+
+  bool m_coalesceCacheLoads;
+  InFlightCalls<std::shared_ptr<CacheableKey>, MissedGet,
+                internal::dereference_hash<std::shared_ptr<CacheableKey>>,
+                internal::dereference_equal_to<std::shared_ptr<CacheableKey>>>
+      m_inFlightGets;
+
+  // guards the lifecycle of the region, taken shared by every operation
+  mutable util::concurrent::sharded_shared_mutex m_rwLock;
   std::vector<std::shared_ptr<CacheableKey>> keys_internal();
   bool containsKey_internal(const std::shared_ptr<CacheableKey>& keyPtr) const;
   void removeRegion(const std::string& name);
@@ -576,6 +659,20 @@ class APACHE_GEODE_EXPORT LocalRegion : public RegionInternal {
       const std::shared_ptr<Serializable>& aCallbackArgument,
       const CacheEventFlags eventFlags);
 
+  /**
+   * Fetches the value of a key missing from the local cache from the server
+   * and, if so configured, the loader. Waits for the fetch of another thread
+   * instead if one is in progress for the key.
+   */
+  GfErrType getNoThrow_coalesced(const std::shared_ptr<CacheableKey>& keyPtr,
+                                 std::shared_ptr<Cacheable>& value,
+                                 std::shared_ptr<VersionTag>& versionTag,
+                                 bool& isLoaderInvoked);
+
+  GfErrType loadNoThrow(const std::shared_ptr<CacheableKey>& keyPtr,
+                        std::shared_ptr<Cacheable>& value,
+                        const std::shared_ptr<Serializable>& aCallbackArgument);
+
   // these classes encapsulate actions specific to update operations
   // used by the template <code>updateNoThrow</code> class
   friend class PutActions;
@@ -109,7 +109,8 @@ GfErrType MapSegment::create(const std::shared_ptr<CacheableKey>& key,
         }
         // good case; go ahead with the create
         if (oldValue == nullptr) {
-          err = putForTrackedEntry(key, newValue, entry, entryImpl, updateCount,
+          auto value = newValue;
+          err = putForTrackedEntry(key, value, entry, entryImpl, updateCount,
                                    versionStamp);
         } else {
           unguardedRemoveActualEntryWithoutCancelTask(key, handler, taskid);
@@ -138,7 +139,7 @@ GfErrType MapSegment::create(const std::shared_ptr<CacheableKey>& key,
  * @brief put a value in the map, replacing if key already exists.
  */
 GfErrType MapSegment::put(const std::shared_ptr<CacheableKey>& key,
-                          const std::shared_ptr<Cacheable>& newValue,
+                          std::shared_ptr<Cacheable>& newValue,
                           std::shared_ptr<MapEntryImpl>& me,
                           std::shared_ptr<Cacheable>& oldValue, int updateCount,
                           int destroyTracker, bool& isUpdate,
@@ -288,9 +289,9 @@ GfErrType MapSegment::removeWhenConcurrencyEnabled(
 
     if (oldValue) me = entryImpl;
 
-    if ((err = putForTrackedEntry(key, CacheableToken::tombstone(), entry,
-                                  entryImpl, updateCount, versionStamp)) ==
-        GF_NOERR) {
+    std::shared_ptr<Cacheable> tombstone = CacheableToken::tombstone();
+    if ((err = putForTrackedEntry(key, tombstone, entry, entryImpl,
+                                  updateCount, versionStamp)) == GF_NOERR) {
       m_tombstoneList->add(entryImpl, handler, expiryTaskID);
       expTaskSet = true;
     }
@@ -635,7 +636,7 @@ std::shared_ptr<Cacheable> MapSegment::getFromDisc(
 
 GfErrType MapSegment::putForTrackedEntry(
     const std::shared_ptr<CacheableKey>& key,
-    const std::shared_ptr<Cacheable>& newValue,
+    std::shared_ptr<Cacheable>& newValue,
     std::shared_ptr<MapEntry>& entry, std::shared_ptr<MapEntryImpl>& entryImpl,
     int updateCount, VersionStamp& versionStamp, DataInput* delta) {
   if (updateCount < 0 || m_concurrencyChecksEnabled) {
@@ -673,7 +674,6 @@ GfErrType MapSegment::putForTrackedEntry(
       using clock = std::chrono::steady_clock;
 
       auto valueWithDelta = std::dynamic_pointer_cast<Delta>(oldValue);
-      auto& newValue1 = const_cast<std::shared_ptr<Cacheable>&>(newValue);
       try {
         if (m_region->getAttributes().getCloningEnabled()) {
           auto tempVal = valueWithDelta->clone();
@@ -684,12 +684,12 @@ GfErrType MapSegment::putForTrackedEntry(
             m_poolDM->updateNotificationStats(true,
                                               clock::now() - currTimeBefore);
           }
-          newValue1 = std::dynamic_pointer_cast<Serializable>(tempVal);
-          entryImpl->setValueI(newValue1);
+          newValue = std::dynamic_pointer_cast<Serializable>(tempVal);
+          entryImpl->setValueI(newValue);
         } else {
           auto currTimeBefore = clock::now();
           valueWithDelta->fromDelta(*delta);
-          newValue1 = std::dynamic_pointer_cast<Serializable>(valueWithDelta);
+          newValue = std::dynamic_pointer_cast<Serializable>(valueWithDelta);
 
           if (m_poolDM) {
             m_poolDM->updateNotificationStats(true,
@@ -153,7 +153,7 @@ class APACHE_GEODE_EXPORT MapSegment {
   }
 
   GfErrType putForTrackedEntry(const std::shared_ptr<CacheableKey>& key,
-                               const std::shared_ptr<Cacheable>& newValue,
+                               std::shared_ptr<Cacheable>& newValue,
                                std::shared_ptr<MapEntry>& entry,
                                std::shared_ptr<MapEntryImpl>& entryImpl,
                                int updateCount, VersionStamp& versionStamp,
@@ -217,7 +217,7 @@ class APACHE_GEODE_EXPORT MapSegment {
    * return error code is something goes wrong.
    */
   GfErrType put(const std::shared_ptr<CacheableKey>& key,
-                const std::shared_ptr<Cacheable>& newValue,
+                std::shared_ptr<Cacheable>& newValue,
                 std::shared_ptr<MapEntryImpl>& me,
                 std::shared_ptr<Cacheable>& oldValue, int updateCount,
                 int destroyTracker, bool& isUpdate,
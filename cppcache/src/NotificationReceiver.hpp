@@ -0,0 +1,76 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_NOTIFICATIONRECEIVER_H_
+#define GEODE_NOTIFICATIONRECEIVER_H_
+
+#include "Task.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * Receives the messages of a subscription channel, either on a thread of
+ * its own or on the threads of a SubscriptionReactor.
+ */
+class NotificationReceiver {
+ public:
+  virtual ~NotificationReceiver() noexcept = default;
+
+  virtual void start() = 0;
+
+  /**
+   * Stops receiving without waiting for a message being processed.
+   */
+  virtual void stopNoblock() noexcept = 0;
+
+  /**
+   * Waits until no message is being processed after stopNoblock.
+   */
+  virtual void wait() noexcept = 0;
+};
+
+/**
+ * NotificationReceiver running a receive loop on a Task of its own.
+ */
+template <class T>
+class TaskNotificationReceiver : public NotificationReceiver {
+ public:
+  TaskNotificationReceiver(T* target, typename Task<T>::Method method,
+                           const char* threadName)
+      : task_(target, method, threadName) {}
+
+  ~TaskNotificationReceiver() noexcept override = default;
+
+  void start() override { task_.start(); }
+
+  void stopNoblock() noexcept override { task_.stopNoblock(); }
+
+  void wait() noexcept override { task_.wait(); }
+
+ private:
+  Task<T> task_;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_NOTIFICATIONRECEIVER_H_
@@ -55,6 +55,11 @@ void PdxHelper::serializePdx(
   auto& cachePerfStats = cacheImpl->getCachePerfStats();
 
   if (pdxII != nullptr) {
+    // instances read from the server and left untouched are already encoded
+    if (pdxII->writeUnmodifiedPdxStream(output)) {
+      return;
+    }
+
     auto piPt = pdxII->getPdxType();
     if (piPt != nullptr &&
         piPt->getTypeId() ==
@@ -67,11 +72,11 @@ void PdxHelper::serializePdx(
     auto plw = PdxLocalWriter(output, piPt, pdxTypeRegistry);
     pdxII->toData(plw);
     plw.endObjectWriting();  // now write typeid
-    int len = 0;
-    uint8_t* pdxStream = plw.getPdxStream(len);
-    pdxII->updatePdxStream(pdxStream, len);
 
-    delete[] pdxStream;
+    // keep the re-encoded fields, skipping the length and typeid header
+    auto pdxStream = output.getBuffer() + plw.getStartPositionOffset();
+    auto len = PdxHelper::readInt32(const_cast<uint8_t*>(pdxStream));
+    pdxII->updatePdxStream(pdxStream + PdxHeader, len);
 
     return;
   }
@@ -105,6 +110,18 @@ void PdxHelper::serializePdx(
 
   } else  // we know locasl type, need to see preerved data
   {
+    // schema types without preserved data need no writer at all
+    auto pdxSchemaObject =
+        dynamic_cast<const PdxSchemaSerializableBase*>(pdxObject.get());
+    if (pdxSchemaObject && !pdxTypeRegistry->getPreserveData(pdxObject)) {
+      auto pdxLen = serializePdxSchema(output, *pdxSchemaObject, *localPdxType);
+      if (cacheImpl != nullptr) {
+        cachePerfStats.incPdxSerialization(
+            pdxLen + 1 + 2 * 4);  // pdxLen + 93 DSID + len + typeID
+      }
+      return;
+    }
+
     // if object got from server than create instance of RemoteWriter otherwise
     // local writer.
     // now always remotewriter as we have API Read/WriteUnreadFields
@@ -136,6 +153,46 @@ void PdxHelper::serializePdx(
   }
 }
 
+int32_t PdxHelper::serializePdxSchema(
+    DataOutput& output, const PdxSchemaSerializableBase& pdxObject,
+    const PdxType& pdxType) {
+  // Same layout as PdxLocalWriter: header, fields, then the offsets of all
+  // variable length fields but the first in reverse order.
+  static thread_local std::vector<int32_t> offsets;
+  offsets.clear();
+
+  auto startPositionOffset = output.getBufferLength();
+  output.advanceCursor(PdxHeader);
+  pdxObject.writePdxFields(output, offsets);
+
+  auto fieldsStart = static_cast<int32_t>(startPositionOffset + PdxHeader);
+  auto totalOffsets =
+      offsets.empty() ? 0 : static_cast<int32_t>(offsets.size()) - 1;
+  auto len = static_cast<int32_t>(output.getBufferLength()) - fieldsStart +
+             totalOffsets;
+  if (len > 0xff) {
+    len += len + totalOffsets <= 0xffff ? totalOffsets : totalOffsets * 3;
+  }
+
+  auto startPosition =
+      const_cast<uint8_t*>(output.getBuffer()) + startPositionOffset;
+  writeInt32(startPosition, len);
+  writeInt32(startPosition + 4, pdxType.getTypeId());
+
+  for (auto i = static_cast<int>(offsets.size()) - 1; i > 0; i--) {
+    auto offset = offsets[i] - fieldsStart;
+    if (len <= 0xff) {
+      output.write(static_cast<uint8_t>(offset));
+    } else if (len <= 0xffff) {
+      output.writeInt(static_cast<uint16_t>(offset));
+    } else {
+      output.writeInt(static_cast<uint32_t>(offset));
+    }
+  }
+
+  return len;
+}
+
 std::shared_ptr<PdxSerializable> PdxHelper::deserializePdx(DataInput& dataInput,
                                                            int32_t typeId,
                                                            int32_t length) {
@@ -160,6 +217,14 @@ std::shared_ptr<PdxSerializable> PdxHelper::deserializePdx(DataInput& dataInput,
     pdxObjectptr = serializationRegistry->getPdxSerializableType(pdxClassname);
     if (pType->isLocal())  // local type no need to read Unread data
     {
+      if (auto pdxSchemaObject =
+              dynamic_cast<PdxSchemaSerializableBase*>(pdxObjectptr.get())) {
+        auto startPosition = dataInput.getBytesRead();
+        pdxSchemaObject->readPdxFields(dataInput);
+        dataInput.reset(startPosition + length);
+        return pdxObjectptr;
+      }
+
       auto plr = PdxLocalReader(dataInput, pType, length, pdxTypeRegistry);
       pdxObjectptr->fromData(plr);
       plr.moveStream();
@@ -21,6 +21,7 @@
 #define GEODE_PDXHELPER_H_
 
 #include <geode/DataOutput.hpp>
+#include <geode/PdxSchema.hpp>
 
 #include "CacheImpl.hpp"
 #include "EnumInfo.hpp"
@@ -41,6 +42,10 @@ class PdxHelper {
       const std::shared_ptr<SerializationRegistry>& serializationRegistry,
       int32_t typeId);
 
+  static int32_t serializePdxSchema(DataOutput& output,
+                                    const PdxSchemaSerializableBase& pdxObject,
+                                    const PdxType& pdxType);
+
  public:
   static uint8_t PdxHeader;
 
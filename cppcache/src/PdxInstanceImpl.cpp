@@ -31,6 +31,14 @@ namespace apache {
 namespace geode {
 namespace client {
 
+namespace {
+
+// precedes the fields of a PdxInstance delta, as a read serialized instance
+// is also sent the deltas of its server side class
+constexpr int32_t PdxInstanceDeltaTag = 0x50445844;  // "PDXD"
+
+}  // namespace
+
 int8_t PdxInstanceImpl::m_BooleanDefaultBytes[] = {0};
 int8_t PdxInstanceImpl::m_ByteDefaultBytes[] = {0};
 int8_t PdxInstanceImpl::m_ShortDefaultBytes[] = {0, 0};
@@ -49,16 +57,6 @@ std::shared_ptr<PdxFieldType> PdxInstanceImpl::m_DefaultPdxFieldType(
     new PdxFieldType("default", "default", PdxFieldTypes::UNKNOWN,
                      -1 /*field index*/, false, 1, -1 /*var len field idx*/));
 
-bool sortFunc(std::shared_ptr<PdxFieldType> field1,
-              std::shared_ptr<PdxFieldType> field2) {
-  const auto diff = field1->getFieldName().compare(field2->getFieldName());
-  if (diff < 0) {
-    return true;
-  } else {
-    return false;
-  }
-}
-
 PdxInstanceImpl::~PdxInstanceImpl() noexcept {}
 
 PdxInstanceImpl::PdxInstanceImpl(const uint8_t* buffer, size_t length,
@@ -72,7 +70,8 @@ PdxInstanceImpl::PdxInstanceImpl(const uint8_t* buffer, size_t length,
       m_cacheStats(cacheStats),
       m_pdxTypeRegistry(pdxTypeRegistry),
       m_cacheImpl(cacheImpl),
-      m_enableTimeStatistics(enableTimeStatistics) {
+      m_enableTimeStatistics(enableTimeStatistics),
+      m_fieldPositionsValid(false) {
   LOGDEBUG("PdxInstanceImpl::m_bufferLength = %zu ", m_buffer.size());
 }
 
@@ -88,7 +87,8 @@ PdxInstanceImpl::PdxInstanceImpl(FieldVsValues fieldVsValue,
       m_cacheStats(cacheStats),
       m_pdxTypeRegistry(pdxTypeRegistry),
       m_cacheImpl(cacheImpl),
-      m_enableTimeStatistics(enableTimeStatistics) {
+      m_enableTimeStatistics(enableTimeStatistics),
+      m_fieldPositionsValid(false) {
   m_pdxType->InitializeType();  // to generate static position map
 }
 
@@ -730,14 +730,12 @@ int32_t PdxInstanceImpl::hashcode() const {
 
   auto pt = getPdxType();
 
-  auto pdxIdentityFieldList = getIdentityPdxFields(pt);
+  const auto& pdxIdentityFieldList = pt->getIdentityPdxFields();
 
   auto dataInput =
       m_cacheImpl.createDataInput(m_buffer.data(), m_buffer.size());
 
-  for (uint32_t i = 0; i < pdxIdentityFieldList.size(); i++) {
-    auto pField = pdxIdentityFieldList.at(i);
-
+  for (auto&& pField : pdxIdentityFieldList) {
     LOGDEBUG("hashcode for pdxfield %s  hashcode is %d ",
              pField->getFieldName().c_str(), hashCode);
     switch (pField->getTypeId()) {
@@ -761,12 +759,12 @@ int32_t PdxInstanceImpl::hashcode() const {
       case PdxFieldTypes::DOUBLE_ARRAY:
       case PdxFieldTypes::STRING_ARRAY:
       case PdxFieldTypes::ARRAY_OF_BYTE_ARRAYS: {
-        int retH = getRawHashCode(pt, pField, dataInput);
+        int retH = getRawHashCode(pField);
         if (retH != 0) hashCode = 31 * hashCode + retH;
         break;
       }
       case PdxFieldTypes::OBJECT: {
-        setOffsetForObject(dataInput, pt, pField->getSequenceId());
+        setOffsetForObject(dataInput, pField->getSequenceId());
         std::shared_ptr<Cacheable> object = nullptr;
         dataInput.readObject(object);
         if (object != nullptr) {
@@ -775,7 +773,7 @@ int32_t PdxInstanceImpl::hashcode() const {
         break;
       }
       case PdxFieldTypes::OBJECT_ARRAY: {
-        setOffsetForObject(dataInput, pt, pField->getSequenceId());
+        setOffsetForObject(dataInput, pField->getSequenceId());
         auto objectArray = CacheableObjectArray::create();
         objectArray->fromData(dataInput);
         hashCode =
@@ -794,9 +792,19 @@ int32_t PdxInstanceImpl::hashcode() const {
   return hashCode;
 }
 
-void PdxInstanceImpl::updatePdxStream(uint8_t* newPdxStream, int len) {
-  m_buffer.resize(len);
-  memcpy(m_buffer.data(), newPdxStream, len);
+void PdxInstanceImpl::updatePdxStream(const uint8_t* newPdxStream, int len) {
+  m_buffer.assign(newPdxStream, newPdxStream + len);
+  invalidateFieldPositions();
+}
+
+bool PdxInstanceImpl::writeUnmodifiedPdxStream(DataOutput& output) const {
+  if (m_typeId == 0 || m_buffer.empty() || !m_updatedFields.empty()) {
+    return false;
+  }
+  output.writeInt(static_cast<int32_t>(m_buffer.size()));
+  output.writeInt(static_cast<int32_t>(m_typeId));
+  output.writeBytesOnly(m_buffer.data(), m_buffer.size());
+  return true;
 }
 
 std::shared_ptr<PdxType> PdxInstanceImpl::getPdxType() const {
@@ -1266,8 +1274,8 @@ bool PdxInstanceImpl::operator==(const CacheableKey& other) const {
       case PdxFieldTypes::DOUBLE_ARRAY:
       case PdxFieldTypes::STRING_ARRAY:
       case PdxFieldTypes::ARRAY_OF_BYTE_ARRAYS: {
-        if (!compareRawBytes(*otherPdx, myPdxType, myPFT, myDataInput,
-                             otherPdxType, otherPFT, otherDataInput)) {
+        if (!compareRawBytes(*otherPdx, myPFT, myDataInput, otherPFT,
+                             otherDataInput)) {
           return false;
         }
         break;
@@ -1276,12 +1284,12 @@ bool PdxInstanceImpl::operator==(const CacheableKey& other) const {
         std::shared_ptr<Cacheable> object = nullptr;
         std::shared_ptr<Cacheable> otherObject = nullptr;
         if (!myPFT->equals(m_DefaultPdxFieldType)) {
-          setOffsetForObject(myDataInput, myPdxType, myPFT->getSequenceId());
+          setOffsetForObject(myDataInput, myPFT->getSequenceId());
           myDataInput.readObject(object);
         }
 
         if (!otherPFT->equals(m_DefaultPdxFieldType)) {
-          otherPdx->setOffsetForObject(otherDataInput, otherPdxType,
+          otherPdx->setOffsetForObject(otherDataInput,
                                        otherPFT->getSequenceId());
           otherDataInput.readObject(otherObject);
         }
@@ -1300,12 +1308,12 @@ bool PdxInstanceImpl::operator==(const CacheableKey& other) const {
         auto objectArray = CacheableObjectArray::create();
 
         if (!myPFT->equals(m_DefaultPdxFieldType)) {
-          setOffsetForObject(myDataInput, myPdxType, myPFT->getSequenceId());
+          setOffsetForObject(myDataInput, myPFT->getSequenceId());
           objectArray->fromData(myDataInput);
         }
 
         if (!otherPFT->equals(m_DefaultPdxFieldType)) {
-          otherPdx->setOffsetForObject(otherDataInput, otherPdxType,
+          otherPdx->setOffsetForObject(otherDataInput,
                                        otherPFT->getSequenceId());
           otherObjectArray->fromData(otherDataInput);
         }
@@ -1326,49 +1334,33 @@ bool PdxInstanceImpl::operator==(const CacheableKey& other) const {
 }
 
 bool PdxInstanceImpl::compareRawBytes(PdxInstanceImpl& other,
-                                      std::shared_ptr<PdxType> myPT,
                                       std::shared_ptr<PdxFieldType> myF,
                                       DataInput& myDataInput,
-                                      std::shared_ptr<PdxType> otherPT,
                                       std::shared_ptr<PdxFieldType> otherF,
                                       DataInput& otherDataInput) const {
   if (!myF->equals(m_DefaultPdxFieldType) &&
       !otherF->equals(m_DefaultPdxFieldType)) {
-    int pos = getOffset(myDataInput, myPT, myF->getSequenceId());
-    int nextpos =
-        getNextFieldPosition(myDataInput, myF->getSequenceId() + 1, myPT);
-    myDataInput.reset();
-    myDataInput.advanceCursor(pos);
-
-    int otherPos =
-        other.getOffset(otherDataInput, otherPT, otherF->getSequenceId());
-    int otherNextpos = other.getNextFieldPosition(
-        otherDataInput, otherF->getSequenceId() + 1, otherPT);
-    otherDataInput.reset();
-    otherDataInput.advanceCursor(otherPos);
+    int pos = getOffset(myF->getSequenceId());
+    int nextpos = getNextFieldPosition(myF->getSequenceId() + 1);
+
+    int otherPos = other.getOffset(otherF->getSequenceId());
+    int otherNextpos = other.getNextFieldPosition(otherF->getSequenceId() + 1);
 
     if ((nextpos - pos) != (otherNextpos - otherPos)) {
       return false;
     }
 
-    for (int i = pos; i < nextpos; i++) {
-      if (myDataInput.read() != otherDataInput.read()) {
-        return false;
-      }
-    }
-
-    return true;
+    return std::equal(m_buffer.begin() + pos, m_buffer.begin() + nextpos,
+                      other.m_buffer.begin() + otherPos);
   } else {
     if (myF->equals(m_DefaultPdxFieldType)) {
-      int otherPos =
-          other.getOffset(otherDataInput, otherPT, otherF->getSequenceId());
-      int otherNextpos = other.getNextFieldPosition(
-          otherDataInput, otherF->getSequenceId() + 1, otherPT);
+      int otherPos = other.getOffset(otherF->getSequenceId());
+      int otherNextpos =
+          other.getNextFieldPosition(otherF->getSequenceId() + 1);
       return hasDefaultBytes(otherF, otherDataInput, otherPos, otherNextpos);
     } else {
-      int pos = getOffset(myDataInput, myPT, myF->getSequenceId());
-      int nextpos =
-          getNextFieldPosition(myDataInput, myF->getSequenceId() + 1, myPT);
+      int pos = getOffset(myF->getSequenceId());
+      int nextpos = getNextFieldPosition(myF->getSequenceId() + 1);
       return hasDefaultBytes(myF, myDataInput, pos, nextpos);
     }
   }
@@ -1402,13 +1394,9 @@ PdxFieldTypes PdxInstanceImpl::getFieldType(
   return pft->getTypeId();
 }
 
-void PdxInstanceImpl::writeUnmodifieldField(DataInput& dataInput, int startPos,
-                                            int endPos,
+void PdxInstanceImpl::writeUnmodifieldField(int startPos, int endPos,
                                             PdxLocalWriter& localWriter) {
-  dataInput.reset(startPos);
-  for (; startPos < endPos; startPos++) {
-    localWriter.writeByte(dataInput.read());
-  }
+  localWriter.writeBytesOnly(m_buffer.data() + startPos, endPos - startPos);
 }
 
 void PdxInstanceImpl::toData(PdxWriter& writer) const {
@@ -1422,8 +1410,6 @@ void PdxInstanceImpl::toDataMutable(PdxWriter& writer) {
   int position = 0;  // ignore typeid and length
   int nextFieldPosition = 0;
   if (m_buffer.size() != 0) {
-    auto dataInput =
-        m_cacheImpl.createDataInput(m_buffer.data(), m_buffer.size());
     for (size_t i = 0; i < pdxFieldList->size(); i++) {
       auto currPf = pdxFieldList->at(i);
       LOGDEBUG("toData fieldName = %s , isVarLengthType = %d ",
@@ -1438,16 +1424,15 @@ void PdxInstanceImpl::toDataMutable(PdxWriter& writer) {
       }
       if (value != nullptr) {
         writeField(writer, currPf->getFieldName(), currPf->getTypeId(), value);
-        position = getNextFieldPosition(dataInput, static_cast<int>(i) + 1, pt);
+        position = getNextFieldPosition(static_cast<int>(i) + 1);
       } else {
         if (currPf->IsVariableLengthType()) {
           // need to add offset
           (static_cast<PdxLocalWriter&>(writer)).addOffset();
         }
         // write raw byte array...
-        nextFieldPosition =
-            getNextFieldPosition(dataInput, static_cast<int>(i) + 1, pt);
-        writeUnmodifieldField(dataInput, position, nextFieldPosition,
+        nextFieldPosition = getNextFieldPosition(static_cast<int>(i) + 1);
+        writeUnmodifieldField(position, nextFieldPosition,
                               static_cast<PdxLocalWriter&>(writer));
         position = nextFieldPosition;  // mark next field;
       }
@@ -1469,6 +1454,93 @@ void PdxInstanceImpl::fromData(PdxReader&) {
       "PdxInstance::FromData( .. ) shouldn't have called");
 }
 
+void PdxInstanceImpl::mergeUpdatedFields() {
+  auto output = m_cacheImpl.createDataOutput();
+  PdxLocalWriter writer(output, getPdxType(),
+                        m_cacheImpl.getPdxTypeRegistry());
+  toDataMutable(writer);
+  writer.endObjectWriting();
+
+  auto pdxStream = output.getBuffer() + writer.getStartPositionOffset();
+  auto len = PdxHelper::readInt32(const_cast<uint8_t*>(pdxStream));
+  updatePdxStream(pdxStream + PdxHelper::PdxHeader, len);
+}
+
+bool PdxInstanceImpl::hasDelta() const {
+  if (m_typeId == 0 || m_buffer.empty() || m_updatedFields.empty()) {
+    return false;
+  }
+
+  // a field not in the type needs a new type, hence the full value
+  auto pt = getPdxType();
+  for (const auto& field : m_updatedFields) {
+    if (pt->getPdxField(field.first) == nullptr) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void PdxInstanceImpl::toDelta(DataOutput& output) const {
+  output.writeInt(PdxInstanceDeltaTag);
+  output.writeInt(static_cast<int32_t>(m_updatedFields.size()));
+  for (const auto& field : m_updatedFields) {
+    output.writeString(field.first);
+    output.writeObject(field.second);
+  }
+}
+
+void PdxInstanceImpl::fromDelta(DataInput& input) {
+  if (!m_cacheImpl.getSystemProperties().pdxInstanceDeltaEnabled()) {
+    throw InvalidDeltaException("PdxInstance deltas are not enabled");
+  }
+
+  auto pt = getPdxType();
+  FieldVsValues fields;
+  try {
+    if (input.readInt32() != PdxInstanceDeltaTag) {
+      throw InvalidDeltaException("Delta is not a PdxInstance delta");
+    }
+    auto count = input.readInt32();
+    for (int32_t i = 0; i < count; i++) {
+      auto fieldName = input.readString();
+      auto value = input.readObject();
+      if (pt->getPdxField(fieldName) == nullptr) {
+        throw InvalidDeltaException("PdxInstance doesn't have field " +
+                                    fieldName);
+      }
+      fields[fieldName] = value;
+    }
+  } catch (const InvalidDeltaException&) {
+    throw;
+  } catch (const std::exception& ex) {
+    throw InvalidDeltaException(
+        std::string("Failed to read PdxInstance delta: ") + ex.what());
+  }
+
+  // the instance is left as it was if the fields can not be merged
+  auto updatedFields = m_updatedFields;
+  for (auto& field : fields) {
+    m_updatedFields[field.first] = std::move(field.second);
+  }
+  try {
+    mergeUpdatedFields();
+  } catch (const std::exception& ex) {
+    m_updatedFields = std::move(updatedFields);
+    throw InvalidDeltaException(
+        std::string("Failed to apply PdxInstance delta: ") + ex.what());
+  }
+}
+
+std::shared_ptr<Delta> PdxInstanceImpl::clone() const {
+  auto copy = std::make_shared<PdxInstanceImpl>(
+      m_buffer.data(), m_buffer.size(), m_typeId, m_cacheStats,
+      m_pdxTypeRegistry, m_cacheImpl, m_enableTimeStatistics);
+  copy->m_pdxType = m_pdxType;
+  copy->m_updatedFields = m_updatedFields;
+  return copy;
+}
+
 const std::string& PdxInstanceImpl::getClassName() const {
   if (m_typeId != 0) {
     auto pdxtype = getPdxTypeRegistry().getPdxType(m_typeId);
@@ -1486,6 +1558,7 @@ void PdxInstanceImpl::setPdxId(int32_t typeId) {
   if (m_typeId == 0) {
     m_typeId = typeId;
     m_pdxType = nullptr;
+    invalidateFieldPositions();
   } else {
     throw IllegalStateException("PdxInstance's typeId is already set.");
   }
@@ -1493,125 +1566,63 @@ void PdxInstanceImpl::setPdxId(int32_t typeId) {
 
 std::vector<std::shared_ptr<PdxFieldType>>
 PdxInstanceImpl::getIdentityPdxFields(std::shared_ptr<PdxType> pt) const {
-  std::vector<std::shared_ptr<PdxFieldType>>* pdxFieldList =
-      pt->getPdxFieldTypes();
-  std::vector<std::shared_ptr<PdxFieldType>> retList;
-  int size = static_cast<int>(pdxFieldList->size());
-  for (int i = 0; i < size; i++) {
-    auto pft = pdxFieldList->at(i);
-    if (pft->getIdentityField()) retList.push_back(pft);
-  }
-
-  if (retList.size() > 0) {
-    std::sort(retList.begin(), retList.end(), sortFunc);
-    return retList;
-  }
-
-  for (int i = 0; i < size; i++) {
-    auto pft = pdxFieldList->at(i);
-    retList.push_back(pft);
+  return pt->getIdentityPdxFields();
+}
+
+const std::vector<int32_t>& PdxInstanceImpl::getFieldPositions() const {
+  if (!m_fieldPositionsValid.load(std::memory_order_acquire)) {
+    std::lock_guard<decltype(m_fieldPositionsMutex)> guard(
+        m_fieldPositionsMutex);
+    if (!m_fieldPositionsValid.load(std::memory_order_relaxed)) {
+      if (m_buffer.empty()) {
+        throw IllegalStateException(
+            "PdxInstance fields cannot be read before it is serialized.");
+      }
+      m_fieldPositionsPdxType = getPdxType();
+      m_fieldPositionsPdxType->getFieldPositions(
+          m_buffer.data(), static_cast<int32_t>(m_buffer.size()),
+          m_fieldPositions);
+      m_fieldPositionsValid.store(true, std::memory_order_release);
+    }
   }
-
-  std::sort(retList.begin(), retList.end(), sortFunc);
-
-  return retList;
+  return m_fieldPositions;
 }
 
-int PdxInstanceImpl::getOffset(DataInput& dataInput,
-                               std::shared_ptr<PdxType> pt,
-                               int sequenceId) const {
-  dataInput.resetPdx(0);
-
-  int offsetSize = 0;
-  int serializedLength = 0;
-  int pdxSerializedLength = static_cast<int32_t>(dataInput.getPdxBytes());
-  LOGDEBUG("getOffset pdxSerializedLength = %d ", pdxSerializedLength);
-  if (pdxSerializedLength <= 0xff) {
-    offsetSize = 1;
-  } else if (pdxSerializedLength <= 0xffff) {
-    offsetSize = 2;
-  } else {
-    offsetSize = 4;
-  }
-
-  if (pt->getNumberOfVarLenFields() > 0) {
-    serializedLength = pdxSerializedLength -
-                       ((pt->getNumberOfVarLenFields() - 1) * offsetSize);
-  } else {
-    serializedLength = pdxSerializedLength;
-  }
+void PdxInstanceImpl::invalidateFieldPositions() {
+  std::lock_guard<decltype(m_fieldPositionsMutex)> guard(m_fieldPositionsMutex);
+  m_fieldPositionsValid.store(false, std::memory_order_release);
+  m_fieldPositionsPdxType = nullptr;
+}
 
-  //[ToDo see if currentBufferPosition can correctly replace GetCursor]
-  uint8_t* offsetsBuffer =
-      const_cast<uint8_t*>(dataInput.currentBufferPosition()) +
-      serializedLength;
-  return pt->getFieldPosition(sequenceId, offsetsBuffer, offsetSize,
-                              serializedLength);
+int PdxInstanceImpl::getOffset(int sequenceId) const {
+  return getFieldPositions()[sequenceId];
 }
 
-int PdxInstanceImpl::getRawHashCode(std::shared_ptr<PdxType> pt,
-                                    std::shared_ptr<PdxFieldType> pField,
-                                    DataInput& dataInput) const {
-  int pos = getOffset(dataInput, pt, pField->getSequenceId());
-  int nextpos =
-      getNextFieldPosition(dataInput, pField->getSequenceId() + 1, pt);
+int PdxInstanceImpl::getRawHashCode(
+    std::shared_ptr<PdxFieldType> pField) const {
+  int pos = getOffset(pField->getSequenceId());
+  int nextpos = getNextFieldPosition(pField->getSequenceId() + 1);
 
   LOGDEBUG("pos = %d nextpos = %d ", pos, nextpos);
 
+  auto dataInput =
+      m_cacheImpl.createDataInput(m_buffer.data(), m_buffer.size());
   if (hasDefaultBytes(pField, dataInput, pos, nextpos)) {
     return 0;  // matched default bytes
   }
 
-  dataInput.reset();
-  dataInput.advanceCursor(nextpos - 1);
-
   int h = 1;
   for (int i = nextpos - 1; i >= pos; i--) {
-    h = 31 * h + static_cast<int>(dataInput.read());
-    dataInput.reset();
-    dataInput.advanceCursor(i - 1);
+    h = 31 * h + static_cast<int8_t>(m_buffer[i]);
   }
   LOGDEBUG("getRawHashCode nbytes = %d, final hashcode = %d ", (nextpos - pos),
            h);
   return h;
 }
 
-int PdxInstanceImpl::getNextFieldPosition(DataInput& dataInput, int fieldId,
-                                          std::shared_ptr<PdxType> pt) const {
-  LOGDEBUG("fieldId = %d pt->getTotalFields() = %d ", fieldId,
-           pt->getTotalFields());
-  if (fieldId == pt->getTotalFields()) {
-    // return serialized length
-    return getSerializedLength(dataInput, pt);
-  } else {
-    return getOffset(dataInput, pt, fieldId);
-  }
-}
-
-int PdxInstanceImpl::getSerializedLength(DataInput& dataInput,
-                                         std::shared_ptr<PdxType> pt) const {
-  dataInput.resetPdx(0);
-
-  int offsetSize = 0;
-  int serializedLength = 0;
-  int pdxSerializedLength = static_cast<int32_t>(dataInput.getPdxBytes());
-  LOGDEBUG("pdxSerializedLength = %d ", pdxSerializedLength);
-  if (pdxSerializedLength <= 0xff) {
-    offsetSize = 1;
-  } else if (pdxSerializedLength <= 0xffff) {
-    offsetSize = 2;
-  } else {
-    offsetSize = 4;
-  }
-
-  if (pt->getNumberOfVarLenFields() > 0) {
-    serializedLength = pdxSerializedLength -
-                       ((pt->getNumberOfVarLenFields() - 1) * offsetSize);
-  } else {
-    serializedLength = pdxSerializedLength;
-  }
-
-  return serializedLength;
+int PdxInstanceImpl::getNextFieldPosition(int fieldId) const {
+  // the entry past the last field holds the serialized length
+  return getFieldPositions()[fieldId];
 }
 
 bool PdxInstanceImpl::compareDefaultBytes(DataInput& dataInput, int start,
@@ -2020,9 +2031,8 @@ void PdxInstanceImpl::setField(const std::string& fieldName, std::string* value,
 }
 
 void PdxInstanceImpl::setOffsetForObject(DataInput& dataInput,
-                                         std::shared_ptr<PdxType> pt,
                                          int sequenceId) const {
-  int pos = getOffset(dataInput, pt, sequenceId);
+  int pos = getOffset(sequenceId);
   dataInput.reset();
   dataInput.advanceCursor(pos);
 }
@@ -2045,8 +2055,8 @@ PdxTypeRegistry& PdxInstanceImpl::getPdxTypeRegistry() const {
 
 DataInput PdxInstanceImpl::getDataInputForField(
     const std::string& fieldname) const {
-  auto pt = getPdxType();
-  auto pft = pt->getPdxField(fieldname);
+  const auto& positions = getFieldPositions();
+  auto pft = m_fieldPositionsPdxType->getPdxField(fieldname);
 
   if (!pft) {
     throw IllegalStateException("PdxInstance doesn't have field " + fieldname);
@@ -2054,10 +2064,7 @@ DataInput PdxInstanceImpl::getDataInputForField(
 
   auto dataInput =
       m_cacheImpl.createDataInput(m_buffer.data(), m_buffer.size());
-  auto pos = getOffset(dataInput, pt, pft->getSequenceId());
-
-  dataInput.reset();
-  dataInput.advanceCursor(pos);
+  dataInput.advanceCursor(positions[pft->getSequenceId()]);
 
   return dataInput;
 }
@@ -20,9 +20,12 @@
 #ifndef GEODE_PDXINSTANCEIMPL_H_
 #define GEODE_PDXINSTANCEIMPL_H_
 
+#include <atomic>
 #include <map>
+#include <mutex>
 #include <vector>
 
+#include <geode/Delta.hpp>
 #include <geode/PdxFieldTypes.hpp>
 #include <geode/PdxInstance.hpp>
 #include <geode/PdxSerializable.hpp>
@@ -38,7 +41,14 @@ namespace client {
 
 typedef std::map<std::string, std::shared_ptr<Cacheable>> FieldVsValues;
 
-class APACHE_GEODE_EXPORT PdxInstanceImpl : public WritablePdxInstance {
+/**
+ * An instance read from the server carries its fields in serialized form.
+ * Fields set since then are sent to the server as a delta: a tag, the number
+ * of updated fields and the name and value of each. Servers that can not
+ * apply the delta are sent the full value instead.
+ */
+class APACHE_GEODE_EXPORT PdxInstanceImpl : public WritablePdxInstance,
+                                            public Delta {
  public:
   ~PdxInstanceImpl() noexcept override;
 
@@ -194,6 +204,28 @@ class APACHE_GEODE_EXPORT PdxInstanceImpl : public WritablePdxInstance {
 
   void setPdxId(int32_t typeId);
 
+  // From Delta
+  /**
+   * Returns true if only fields of the type an instance read from the server
+   * has been set.
+   */
+  bool hasDelta() const override;
+
+  /**
+   * Writes the updated fields. They are kept, so the full value can still be
+   * sent if the server rejects the delta.
+   */
+  void toDelta(DataOutput& output) const override;
+
+  /**
+   * Applies a delta written by toDelta. Throws InvalidDeltaException, leaving
+   * the instance unchanged, for any other delta, such as one of the server
+   * side class, or if pdx-instance-delta-enabled is not set.
+   */
+  void fromDelta(DataInput& input) override;
+
+  std::shared_ptr<Delta> clone() const override;
+
  public:
   /**
    * @brief constructors
@@ -213,7 +245,14 @@ class APACHE_GEODE_EXPORT PdxInstanceImpl : public WritablePdxInstance {
 
   std::shared_ptr<PdxType> getPdxType() const;
 
-  void updatePdxStream(uint8_t* newPdxStream, int len);
+  void updatePdxStream(const uint8_t* newPdxStream, int len);
+
+  /**
+   * Writes the PDX header and the original serialized fields straight to
+   * output if no field has been modified since the instance was read.
+   * Returns false when the instance has to be re-encoded instead.
+   */
+  bool writeUnmodifiedPdxStream(DataOutput& output) const;
 
  private:
   std::vector<uint8_t> m_buffer;
@@ -225,21 +264,28 @@ class APACHE_GEODE_EXPORT PdxInstanceImpl : public WritablePdxInstance {
   const CacheImpl& m_cacheImpl;
   bool m_enableTimeStatistics;
 
+  /**
+   * Position of each field in m_buffer indexed by sequence id, followed by
+   * the serialized length. Built on first field access and reset whenever
+   * m_buffer or the type changes.
+   */
+  mutable std::vector<int32_t> m_fieldPositions;
+  mutable std::shared_ptr<PdxType> m_fieldPositionsPdxType;
+  mutable std::atomic<bool> m_fieldPositionsValid;
+  mutable std::mutex m_fieldPositionsMutex;
+
+  const std::vector<int32_t>& getFieldPositions() const;
+
+  void invalidateFieldPositions();
+
   std::vector<std::shared_ptr<PdxFieldType>> getIdentityPdxFields(
       std::shared_ptr<PdxType> pt) const;
 
-  int getOffset(DataInput& dataInput, std::shared_ptr<PdxType> pt,
-                int sequenceId) const;
-
-  int getRawHashCode(std::shared_ptr<PdxType> pt,
-                     std::shared_ptr<PdxFieldType> pField,
-                     DataInput& dataInput) const;
+  int getOffset(int sequenceId) const;
 
-  int getNextFieldPosition(DataInput& dataInput, int fieldId,
-                           std::shared_ptr<PdxType> pt) const;
+  int getRawHashCode(std::shared_ptr<PdxFieldType> pField) const;
 
-  int getSerializedLength(DataInput& dataInput,
-                          std::shared_ptr<PdxType> pt) const;
+  int getNextFieldPosition(int fieldId) const;
 
   bool hasDefaultBytes(std::shared_ptr<PdxFieldType> pField,
                        DataInput& dataInput, int start, int end) const;
@@ -250,15 +296,14 @@ class APACHE_GEODE_EXPORT PdxInstanceImpl : public WritablePdxInstance {
   void writeField(PdxWriter& writer, const std::string& fieldName,
                   PdxFieldTypes typeId, std::shared_ptr<Cacheable> value);
 
-  void writeUnmodifieldField(DataInput& dataInput, int startPos, int endPos,
+  void writeUnmodifieldField(int startPos, int endPos,
                              PdxLocalWriter& localWriter);
 
-  void setOffsetForObject(DataInput& dataInput, std::shared_ptr<PdxType> pt,
-                          int sequenceId) const;
+  void setOffsetForObject(DataInput& dataInput, int sequenceId) const;
 
-  bool compareRawBytes(PdxInstanceImpl& other, std::shared_ptr<PdxType> myPT,
+  bool compareRawBytes(PdxInstanceImpl& other,
                        std::shared_ptr<PdxFieldType> myF,
-                       DataInput& myDataInput, std::shared_ptr<PdxType> otherPT,
+                       DataInput& myDataInput,
                        std::shared_ptr<PdxFieldType> otherF,
                        DataInput& otherDataInput) const;
 
@@ -269,6 +314,11 @@ class APACHE_GEODE_EXPORT PdxInstanceImpl : public WritablePdxInstance {
 
   void toDataMutable(PdxWriter& output);
 
+  /**
+   * Re-encodes the serialized fields with the updated fields applied.
+   */
+  void mergeUpdatedFields();
+
   static int deepArrayHashCode(std::shared_ptr<Cacheable> obj);
 
   static int enumerateMapHashCode(std::shared_ptr<CacheableHashMap> map);
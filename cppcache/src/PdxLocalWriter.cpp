@@ -341,6 +341,10 @@ uint8_t* PdxLocalWriter::getPdxStream(int& pdxLen) {
 
 void PdxLocalWriter::writeByte(int8_t byte) { m_dataOutput->write(byte); }
 
+void PdxLocalWriter::writeBytesOnly(const uint8_t* bytes, size_t len) {
+  m_dataOutput->writeBytesOnly(bytes, len);
+}
+
 std::shared_ptr<PdxTypeRegistry> PdxLocalWriter::getPdxTypeRegistry() const {
   return m_pdxTypeRegistry;
 }
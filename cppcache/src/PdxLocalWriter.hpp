@@ -202,6 +202,8 @@ class PdxLocalWriter : public PdxWriter {
 
   void writeByte(int8_t byte);
 
+  void writeBytesOnly(const uint8_t* bytes, size_t len);
+
   inline int32_t getStartPositionOffset() { return m_startPositionOffset; }
 
  private:
@@ -23,6 +23,8 @@
 
 #include "PdxType.hpp"
 
+#include <algorithm>
+
 #include "PdxFieldType.hpp"
 #include "PdxHelper.hpp"
 #include "PdxTypeRegistry.hpp"
@@ -298,7 +300,10 @@ void PdxType::initLocalToRemote() {
 void PdxType::InitializeType() {
   initRemoteToLocal();  // for writing
   initLocalToRemote();  // for reading
-  generatePositionMap();
+  std::call_once(m_fieldLayoutOnce, [this] {
+    generatePositionMap();
+    generateIdentityFields();
+  });
 }
 
 int32_t PdxType::getFieldPosition(const std::string& fieldName,
@@ -366,6 +371,51 @@ int32_t PdxType::variableLengthFieldPosition(
   }
 }
 
+void PdxType::getFieldPositions(const uint8_t* pdxStream,
+                                int32_t pdxStreamLen,
+                                std::vector<int32_t>& positions) const {
+  int32_t offsetSize;
+  if (pdxStreamLen <= 0xff) {
+    offsetSize = 1;
+  } else if (pdxStreamLen <= 0xffff) {
+    offsetSize = 2;
+  } else {
+    offsetSize = 4;
+  }
+
+  auto serializedLength = pdxStreamLen;
+  if (m_numberOfVarLenFields > 0) {
+    serializedLength -= (m_numberOfVarLenFields - 1) * offsetSize;
+  }
+
+  // offsets are written from behind, right after the serialized fields
+  auto offsetPosition = const_cast<uint8_t*>(pdxStream) + serializedLength;
+  auto readOffset = [&](int32_t varLenOffsetIndex) {
+    return PdxHelper::readInt(
+        offsetPosition +
+            (m_numberOfVarLenFields - varLenOffsetIndex - 1) * offsetSize,
+        offsetSize);
+  };
+
+  positions.resize(m_fieldPositions.size() + 1);
+  for (size_t i = 0; i < m_fieldPositions.size(); i++) {
+    const auto& field = m_fieldPositions[i];
+    if (field.isVariableLength) {
+      positions[i] = field.varLenOffsetIndex == -1
+                         ? field.relativeOffset
+                         : readOffset(field.varLenOffsetIndex);
+    } else if (field.relativeOffset >= 0) {
+      positions[i] = field.relativeOffset;
+    } else if (field.varLenOffsetIndex == -1) {
+      positions[i] = serializedLength + field.relativeOffset;
+    } else {
+      positions[i] =
+          readOffset(field.varLenOffsetIndex) + field.relativeOffset;
+    }
+  }
+  positions[m_fieldPositions.size()] = serializedLength;
+}
+
 int32_t* PdxType::getLocalToRemoteMap() {
   if (m_localToRemoteFieldMap != nullptr) {
     return m_localToRemoteFieldMap;
@@ -540,6 +590,33 @@ void PdxType::generatePositionMap() {
       prevFixedSizeOffsets += tmpft->getFixedSize();
     }
   }
+
+  m_fieldPositions.clear();
+  m_fieldPositions.reserve(m_pdxFieldTypes->size());
+  for (auto&& field : *m_pdxFieldTypes) {
+    m_fieldPositions.push_back({field->getRelativeOffset(),
+                                field->getVarLenOffsetIndex(),
+                                field->IsVariableLengthType()});
+  }
+}
+
+void PdxType::generateIdentityFields() {
+  m_identityFields.clear();
+  for (auto&& field : *m_pdxFieldTypes) {
+    if (field->getIdentityField()) {
+      m_identityFields.push_back(field);
+    }
+  }
+
+  if (m_identityFields.empty()) {
+    m_identityFields.assign(m_pdxFieldTypes->begin(), m_pdxFieldTypes->end());
+  }
+
+  std::sort(m_identityFields.begin(), m_identityFields.end(),
+            [](const std::shared_ptr<PdxFieldType>& field1,
+               const std::shared_ptr<PdxFieldType>& field2) {
+              return field1->getFieldName() < field2->getFieldName();
+            });
 }
 
 bool PdxType::operator==(const PdxType& other) const {
@@ -22,6 +22,7 @@
 
 #include <list>
 #include <map>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -70,6 +71,25 @@ class PdxType : public internal::DataSerializableInternal,
 
   NameVsPdxType m_fieldNameVsPdxType;
 
+  /**
+   * Position information for each field, indexed by sequence id, flattened
+   * out of the PdxFieldType instances by generatePositionMap() so that
+   * getFieldPositions() can walk them without touching shared pointers.
+   */
+  struct FieldPosition {
+    int32_t relativeOffset;
+    int32_t varLenOffsetIndex;
+    bool isVariableLength;
+  };
+
+  std::vector<FieldPosition> m_fieldPositions;
+
+  std::vector<std::shared_ptr<PdxFieldType>> m_identityFields;
+
+  // the field layout is fixed once a type is initialized, so the position
+  // map and identity fields are built once and then only read
+  std::once_flag m_fieldLayoutOnce;
+
   bool is_java_class_;
 
   PdxTypeRegistry& m_pdxTypeRegistry;
@@ -91,6 +111,8 @@ class PdxType : public internal::DataSerializableInternal,
   std::shared_ptr<PdxType> clone();
   void generatePositionMap();
 
+  void generateIdentityFields();
+
   std::shared_ptr<PdxType> isLocalTypeContains(
       std::shared_ptr<PdxType> otherType);
   std::shared_ptr<PdxType> isRemoteTypeContains(
@@ -199,6 +221,25 @@ class PdxType : public internal::DataSerializableInternal,
   int32_t getFieldPosition(int32_t fieldIdx, uint8_t* offsetPosition,
                            int32_t offsetSize, int32_t pdxStreamlen);
 
+  /**
+   * Computes the position of every field in a serialized instance of this
+   * type with a single pass over its offset table. On return positions[i]
+   * holds the start of the field with sequence id i and
+   * positions[getTotalFields()] holds the serialized length without the
+   * offset table.
+   */
+  void getFieldPositions(const uint8_t* pdxStream, int32_t pdxStreamLen,
+                         std::vector<int32_t>& positions) const;
+
+  /**
+   * The fields that take part in equals and hashcode, sorted by name. These
+   * are the identity fields if any were marked, otherwise all fields.
+   */
+  const std::vector<std::shared_ptr<PdxFieldType>>& getIdentityPdxFields()
+      const {
+    return m_identityFields;
+  }
+
   int32_t* getLocalToRemoteMap();
 
   int32_t* getRemoteToLocalMap();
@@ -27,6 +27,36 @@ namespace apache {
 namespace geode {
 namespace client {
 
+namespace {
+
+template <class Map>
+typename Map::mapped_type findInSnapshot(
+    const util::concurrent::snapshot<Map>& snapshot,
+    const typename Map::key_type& key) {
+  return snapshot.read([&key](const Map& map) -> typename Map::mapped_type {
+    auto&& iter = map.find(key);
+    if (iter != map.end()) {
+      return iter->second;
+    }
+    return nullptr;
+  });
+}
+
+// Caller must hold the registry write lock.
+template <class Map>
+void emplaceInSnapshot(util::concurrent::snapshot<Map>& snapshot,
+                       const typename Map::key_type& key,
+                       typename Map::mapped_type value) {
+  if (findInSnapshot(snapshot, key)) {
+    return;
+  }
+  snapshot.update([&key, &value](Map& map) {
+    map.emplace(key, std::move(value));
+  });
+}
+
+}  // namespace
+
 PdxTypeRegistry::PdxTypeRegistry(CacheImpl* cache)
     : cache_(cache),
       typeIdToPdxType_(),
@@ -89,7 +119,7 @@ int32_t PdxTypeRegistry::getPDXIdForType(std::shared_ptr<PdxType> nType,
     typeId = cache_->getSerializationRegistry()->GetPDXIdForType(pool, nType);
     nType->setTypeId(typeId);
     pdxTypeToTypeIdMap_.emplace(nType, typeId);
-    typeIdToPdxType_.emplace(typeId, nType);
+    emplaceInSnapshot(typeIdToPdxType_, typeId, nType);
   }
   return typeId;
 }
@@ -118,47 +148,34 @@ void PdxTypeRegistry::clear() {
 void PdxTypeRegistry::addPdxType(int32_t typeId,
                                  std::shared_ptr<PdxType> pdxType) {
   WriteGuard guard(g_readerWriterLock_);
-  typeIdToPdxType_.emplace(typeId, pdxType);
+  emplaceInSnapshot(typeIdToPdxType_, typeId, std::move(pdxType));
 }
 
 std::shared_ptr<PdxType> PdxTypeRegistry::getPdxType(int32_t typeId) const {
-  ReadGuard guard(g_readerWriterLock_);
-  auto&& iter = typeIdToPdxType_.find(typeId);
-  if (iter != typeIdToPdxType_.end()) {
-    return iter->second;
-  }
-  return nullptr;
+  return findInSnapshot(typeIdToPdxType_, typeId);
 }
 
 void PdxTypeRegistry::addLocalPdxType(const std::string& localType,
                                       std::shared_ptr<PdxType> pdxType) {
   WriteGuard guard(g_readerWriterLock_);
-  localTypeToPdxType_.emplace(localType, pdxType);
+  emplaceInSnapshot(localTypeToPdxType_, localType, std::move(pdxType));
 }
 
 std::shared_ptr<PdxType> PdxTypeRegistry::getLocalPdxType(
     const std::string& localType) const {
-  ReadGuard guard(g_readerWriterLock_);
-  auto&& it = localTypeToPdxType_.find(localType);
-  if (it != localTypeToPdxType_.end()) {
-    return it->second;
-  }
-  return nullptr;
+  return findInSnapshot(localTypeToPdxType_, localType);
 }
 
 void PdxTypeRegistry::setMergedType(int32_t remoteTypeId,
                                     std::shared_ptr<PdxType> mergedType) {
   WriteGuard guard(g_readerWriterLock_);
-  remoteTypeIdToMergedPdxType_.emplace(remoteTypeId, mergedType);
+  emplaceInSnapshot(remoteTypeIdToMergedPdxType_, remoteTypeId,
+                    std::move(mergedType));
 }
 
 std::shared_ptr<PdxType> PdxTypeRegistry::getMergedType(
     int32_t remoteTypeId) const {
-  auto&& it = remoteTypeIdToMergedPdxType_.find(remoteTypeId);
-  if (it != remoteTypeIdToMergedPdxType_.end()) {
-    return it->second;
-  }
-  return nullptr;
+  return findInSnapshot(remoteTypeIdToMergedPdxType_, remoteTypeId);
 }
 
 void PdxTypeRegistry::setPreserveData(
@@ -20,7 +20,7 @@
 #ifndef GEODE_PDXTYPEREGISTRY_H_
 #define GEODE_PDXTYPEREGISTRY_H_
 
-#include <map>
+#include <memory>
 #include <unordered_map>
 
 #include <geode/Cache.hpp>
@@ -33,13 +33,15 @@
 #include "PdxType.hpp"
 #include "PreservedDataExpiryHandler.hpp"
 #include "ReadWriteLock.hpp"
+#include "util/concurrent/snapshot.hpp"
 
 namespace apache {
 namespace geode {
 namespace client {
 
-typedef std::map<int32_t, std::shared_ptr<PdxType>> TypeIdVsPdxType;
-typedef std::map<std::string, std::shared_ptr<PdxType>> TypeNameVsPdxType;
+typedef std::unordered_map<int32_t, std::shared_ptr<PdxType>> TypeIdVsPdxType;
+typedef std::unordered_map<std::string, std::shared_ptr<PdxType>>
+    TypeNameVsPdxType;
 typedef std::unordered_map<std::shared_ptr<PdxSerializable>,
                            std::shared_ptr<PdxRemotePreservedData>,
                            dereference_hash<std::shared_ptr<CacheableKey>>,
@@ -56,11 +58,15 @@ class APACHE_GEODE_EXPORT PdxTypeRegistry
  private:
   CacheImpl* cache_;
 
-  TypeIdVsPdxType typeIdToPdxType_;
+  // The type maps are read on every PDX (de)serialization but only grow when
+  // a new type is seen, so they are published as immutable snapshots. Readers
+  // never take g_readerWriterLock_; writers copy, update and republish a map
+  // while holding it.
+  util::concurrent::snapshot<TypeIdVsPdxType> typeIdToPdxType_;
 
-  TypeIdVsPdxType remoteTypeIdToMergedPdxType_;
+  util::concurrent::snapshot<TypeIdVsPdxType> remoteTypeIdToMergedPdxType_;
 
-  TypeNameVsPdxType localTypeToPdxType_;
+  util::concurrent::snapshot<TypeNameVsPdxType> localTypeToPdxType_;
 
   PdxTypeToTypeIdMap pdxTypeToTypeIdMap_;
 
@@ -94,6 +94,10 @@ bool Pool::getThreadLocalConnections() const {
   return m_attrs->getThreadLocalConnectionSetting();
 }
 
+bool Pool::getThreadAffineConnections() const {
+  return m_attrs->getThreadAffineConnectionSetting();
+}
+
 bool Pool::getMultiuserAuthentication() const {
   return m_attrs->getMultiuserSecureModeEnabled();
 }
@@ -25,6 +25,7 @@ namespace client {
 
 PoolAttributes::PoolAttributes()
     : m_isThreadLocalConn(PoolFactory::DEFAULT_THREAD_LOCAL_CONN),
+      m_isThreadAffineConn(PoolFactory::DEFAULT_THREAD_AFFINE_CONN),
       m_freeConnTimeout(PoolFactory::DEFAULT_FREE_CONNECTION_TIMEOUT),
       m_loadCondInterval(PoolFactory::DEFAULT_LOAD_CONDITIONING_INTERVAL),
       m_sockBufferSize(PoolFactory::DEFAULT_SOCKET_BUFFER_SIZE),
@@ -75,6 +75,14 @@ class PoolAttributes {
     m_isThreadLocalConn = isThreadLocal;
   }
 
+  bool getThreadAffineConnectionSetting() const {
+    return m_isThreadAffineConn;
+  }
+
+  void setThreadAffineConnectionSetting(bool isThreadAffine) {
+    m_isThreadAffineConn = isThreadAffine;
+  }
+
   int getMinConnections() const { return m_minConns; }
 
   void setMinConnections(int minConnections) { m_minConns = minConnections; }
@@ -178,6 +186,7 @@ class PoolAttributes {
 
  private:
   bool m_isThreadLocalConn;
+  bool m_isThreadAffineConn;
   std::chrono::milliseconds m_freeConnTimeout;
   std::chrono::milliseconds m_loadCondInterval;
   int m_sockBufferSize;
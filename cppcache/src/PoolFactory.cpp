@@ -100,6 +100,12 @@ PoolFactory& PoolFactory::setThreadLocalConnections(
   return *this;
 }
 
+PoolFactory& PoolFactory::setThreadAffineConnections(
+    bool threadAffineConnections) {
+  m_attrs->setThreadAffineConnectionSetting(threadAffineConnections);
+  return *this;
+}
+
 PoolFactory& PoolFactory::setReadTimeout(std::chrono::milliseconds timeout) {
   if (timeout <= std::chrono::milliseconds::zero()) {
     throw IllegalArgumentException("timeout must be greater than 0.");
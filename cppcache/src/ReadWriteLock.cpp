@@ -23,9 +23,21 @@ namespace client {
 
 TryReadGuard::TryReadGuard(ACE_RW_Thread_Mutex& lock,
                            const volatile bool& exitCondition)
-    : lock_(lock), isAcquired_(false) {
+    : lock_(&lock), shardedLock_(nullptr), isAcquired_(false) {
   do {
-    if (lock_.tryacquire_read() != -1) {
+    if (lock_->tryacquire_read() != -1) {
+      isAcquired_ = true;
+      break;
+    }
+    ACE_OS::thr_yield();
+  } while (!exitCondition);
+}
+
+TryReadGuard::TryReadGuard(util::concurrent::sharded_shared_mutex& lock,
+                           const volatile bool& exitCondition)
+    : lock_(nullptr), shardedLock_(&lock), isAcquired_(false) {
+  do {
+    if (shardedLock_->try_lock_shared()) {
       isAcquired_ = true;
       break;
     }
@@ -35,9 +47,21 @@ TryReadGuard::TryReadGuard(ACE_RW_Thread_Mutex& lock,
 
 TryWriteGuard::TryWriteGuard(ACE_RW_Thread_Mutex& lock,
                              const volatile bool& exitCondition)
-    : lock_(lock), isAcquired_(false) {
+    : lock_(&lock), shardedLock_(nullptr), isAcquired_(false) {
+  do {
+    if (lock_->tryacquire_write() != -1) {
+      isAcquired_ = true;
+      break;
+    }
+    ACE_OS::thr_yield();
+  } while (!exitCondition);
+}
+
+TryWriteGuard::TryWriteGuard(util::concurrent::sharded_shared_mutex& lock,
+                             const volatile bool& exitCondition)
+    : lock_(nullptr), shardedLock_(&lock), isAcquired_(false) {
   do {
-    if (lock_.tryacquire_write() != -1) {
+    if (shardedLock_->try_lock()) {
       isAcquired_ = true;
       break;
     }
@@ -24,6 +24,8 @@
 
 #include <geode/internal/geode_globals.hpp>
 
+#include "util/concurrent/sharded_shared_mutex.hpp"
+
 namespace apache {
 namespace geode {
 namespace client {
@@ -43,39 +45,72 @@ class APACHE_GEODE_EXPORT ReadGuard {
 
 class WriteGuard {
  public:
-  explicit WriteGuard(ACE_RW_Thread_Mutex& lock) : lock_(lock) {
-    lock_.acquire_write();
+  explicit WriteGuard(ACE_RW_Thread_Mutex& lock)
+      : lock_(&lock), shardedLock_(nullptr) {
+    lock_->acquire_write();
+  }
+
+  explicit WriteGuard(util::concurrent::sharded_shared_mutex& lock)
+      : lock_(nullptr), shardedLock_(&lock) {
+    shardedLock_->lock();
   }
 
-  ~WriteGuard() { lock_.release(); }
+  ~WriteGuard() {
+    if (lock_) {
+      lock_->release();
+    } else {
+      shardedLock_->unlock();
+    }
+  }
 
  private:
-  ACE_RW_Thread_Mutex& lock_;
+  ACE_RW_Thread_Mutex* lock_;
+  util::concurrent::sharded_shared_mutex* shardedLock_;
 };
 
 class TryReadGuard {
  public:
   TryReadGuard(ACE_RW_Thread_Mutex& lock, const volatile bool& exitCondition);
+  TryReadGuard(util::concurrent::sharded_shared_mutex& lock,
+               const volatile bool& exitCondition);
   ~TryReadGuard() {
-    if (isAcquired_) lock_.release();
+    if (!isAcquired_) {
+      return;
+    }
+    if (lock_) {
+      lock_->release();
+    } else {
+      shardedLock_->unlock_shared();
+    }
   }
   bool isAcquired() const { return isAcquired_; }
 
  private:
-  ACE_RW_Thread_Mutex& lock_;
+  ACE_RW_Thread_Mutex* lock_;
+  util::concurrent::sharded_shared_mutex* shardedLock_;
   bool isAcquired_;
 };
 
 class TryWriteGuard {
  public:
   TryWriteGuard(ACE_RW_Thread_Mutex& lock, const volatile bool& exitCondition);
+  TryWriteGuard(util::concurrent::sharded_shared_mutex& lock,
+                const volatile bool& exitCondition);
   ~TryWriteGuard() {
-    if (isAcquired_) lock_.release();
+    if (!isAcquired_) {
+      return;
+    }
+    if (lock_) {
+      lock_->release();
+    } else {
+      shardedLock_->unlock();
+    }
   }
   bool isAcquired() const { return isAcquired_; }
 
  private:
-  ACE_RW_Thread_Mutex& lock_;
+  ACE_RW_Thread_Mutex* lock_;
+  util::concurrent::sharded_shared_mutex* shardedLock_;
   bool isAcquired_;
 };
 }  // namespace client
@@ -55,7 +55,9 @@ RegionAttributes::RegionAttributes()
       m_persistenceProperties(nullptr),
       m_persistenceManager(nullptr),
       m_isClonable(false),
-      m_isConcurrencyChecksEnabled(true) {}
+      m_isConcurrencyChecksEnabled(true),
+      m_valueStorage(ValueStorageType::OBJECT),
+      m_deserializedValueCacheSize(0) {}
 
 RegionAttributes::~RegionAttributes() noexcept = default;
 
@@ -251,6 +253,14 @@ uint32_t RegionAttributes::getLruEntriesLimit() const {
 
 DiskPolicyType RegionAttributes::getDiskPolicy() const { return m_diskPolicy; }
 
+ValueStorageType RegionAttributes::getValueStorage() const {
+  return m_valueStorage;
+}
+
+uint32_t RegionAttributes::getDeserializedValueCacheSize() const {
+  return m_deserializedValueCacheSize;
+}
+
 std::shared_ptr<Serializable> RegionAttributes::createDeserializable() {
   return std::make_shared<RegionAttributes>();
 }
@@ -314,6 +324,8 @@ void RegionAttributes::toData(DataOutput& out) const {
   out.writeObject(m_persistenceProperties);
   apache::geode::client::impl::writeString(out, m_poolName);
   apache::geode::client::impl::writeBool(out, m_isConcurrencyChecksEnabled);
+  out.writeInt(static_cast<int32_t>(m_valueStorage));
+  out.writeInt(static_cast<int32_t>(m_deserializedValueCacheSize));
 }
 
 void RegionAttributes::fromData(DataInput& in) {
@@ -355,6 +367,8 @@ void RegionAttributes::fromData(DataInput& in) {
       std::dynamic_pointer_cast<Properties>(in.readObject());
   apache::geode::client::impl::readString(in, m_poolName);
   apache::geode::client::impl::readBool(in, &m_isConcurrencyChecksEnabled);
+  m_valueStorage = static_cast<ValueStorageType>(in.readInt32());
+  m_deserializedValueCacheSize = in.readInt32();
 }
 
 /** Return true if all the attributes are equal to those of other. */
@@ -429,6 +443,12 @@ bool RegionAttributes::operator==(const RegionAttributes& other) const {
   if (m_isConcurrencyChecksEnabled != other.m_isConcurrencyChecksEnabled) {
     return false;
   }
+  if (m_valueStorage != other.m_valueStorage) {
+    return false;
+  }
+  if (m_deserializedValueCacheSize != other.m_deserializedValueCacheSize) {
+    return false;
+  }
 
   return true;
 }
@@ -525,6 +545,14 @@ void RegionAttributes::setConcurrencyChecksEnabled(bool enable) {
   m_isConcurrencyChecksEnabled = enable;
 }
 
+void RegionAttributes::setValueStorage(ValueStorageType valueStorage) {
+  m_valueStorage = valueStorage;
+}
+
+void RegionAttributes::setDeserializedValueCacheSize(uint32_t size) {
+  m_deserializedValueCacheSize = size;
+}
+
 }  // namespace client
 }  // namespace geode
 }  // namespace apache
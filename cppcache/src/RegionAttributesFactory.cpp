@@ -176,6 +176,11 @@ void RegionAttributesFactory::validateAttributes(RegionAttributes& attrs) {
       throw IllegalStateException(
           "LRU entries limit cannot be zero if DiskPolicy is OVERFLOWS");
     }
+    if (attrs.m_valueStorage != ValueStorageType::OBJECT) {
+      throw IllegalStateException(
+          "Serialized or compressed value storage is incompatible with "
+          "DiskPolicy OVERFLOWS");
+    }
   }
 }
 
@@ -232,6 +237,18 @@ RegionAttributesFactory& RegionAttributesFactory::setConcurrencyChecksEnabled(
   return *this;
 }
 
+RegionAttributesFactory& RegionAttributesFactory::setValueStorage(
+    ValueStorageType valueStorage) {
+  m_regionAttributes.setValueStorage(valueStorage);
+  return *this;
+}
+
+RegionAttributesFactory& RegionAttributesFactory::setDeserializedValueCacheSize(
+    uint32_t size) {
+  m_regionAttributes.setDeserializedValueCacheSize(size);
+  return *this;
+}
+
 }  // namespace client
 }  // namespace geode
 }  // namespace apache
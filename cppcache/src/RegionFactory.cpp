@@ -210,6 +210,16 @@ RegionFactory& RegionFactory::setCloningEnabled(bool isClonable) {
   m_regionAttributesFactory->setCloningEnabled(isClonable);
   return *this;
 }
+
+RegionFactory& RegionFactory::setValueStorage(ValueStorageType valueStorage) {
+  m_regionAttributesFactory->setValueStorage(valueStorage);
+  return *this;
+}
+
+RegionFactory& RegionFactory::setDeserializedValueCacheSize(uint32_t size) {
+  m_regionAttributesFactory->setDeserializedValueCacheSize(size);
+  return *this;
+}
 }  // namespace client
 }  // namespace geode
 }  // namespace apache
@@ -32,7 +32,7 @@ RegionStats::RegionStats(StatisticsFactory* factory,
 
   if (!statsType) {
     const bool largerIsBetter = true;
-    std::vector<std::shared_ptr<StatisticDescriptor>> stats(25);
+    std::vector<std::shared_ptr<StatisticDescriptor>> stats(33);
     stats[0] = factory->createIntCounter(
         "creates", "The total number of cache creates for this region",
         "entries", largerIsBetter);
@@ -127,6 +127,42 @@ RegionStats::RegionStats(StatisticsFactory* factory,
         "removeAllTime",
         "Total time spent doing removeAlls operations for this region",
         "Nanoseconds", !largerIsBetter);
+    stats[25] = factory->createLongGauge(
+        "storedValueBytes",
+        "The current number of bytes of the values this region stores in "
+        "serialized or compressed form",
+        "bytes", !largerIsBetter);
+    stats[26] = factory->createIntCounter(
+        "coalescedGets",
+        "The total number of cache misses for this region that received the "
+        "value fetched for a concurrent miss of the same key",
+        "entries", largerIsBetter);
+    stats[27] = factory->createIntCounter(
+        "compressions",
+        "The total number of values compressed for this region", "operations",
+        largerIsBetter);
+    stats[28] = factory->createLongCounter(
+        "compressTime",
+        "Total time spent compressing values for this region", "Nanoseconds",
+        !largerIsBetter);
+    stats[29] = factory->createIntCounter(
+        "decompressions",
+        "The total number of values decompressed for this region",
+        "operations", largerIsBetter);
+    stats[30] = factory->createLongCounter(
+        "decompressTime",
+        "Total time spent decompressing values for this region", "Nanoseconds",
+        !largerIsBetter);
+    stats[31] = factory->createLongCounter(
+        "preCompressedBytes",
+        "The total number of serialized bytes of the values compressed for "
+        "this region",
+        "bytes", largerIsBetter);
+    stats[32] = factory->createLongCounter(
+        "postCompressedBytes",
+        "The total number of bytes the values compressed for this region "
+        "were compressed to",
+        "bytes", !largerIsBetter);
     statsType = factory->createType(STATS_NAME, STATS_DESC, std::move(stats));
   }
 
@@ -144,6 +180,7 @@ RegionStats::RegionStats(StatisticsFactory* factory,
   m_getAllTimeId = statsType->nameToId("getAllTime");
   m_hitsId = statsType->nameToId("hits");
   m_missesId = statsType->nameToId("misses");
+  m_coalescedGetsId = statsType->nameToId("coalescedGets");
   m_entriesId = statsType->nameToId("entries");
   m_overflowsId = statsType->nameToId("overflows");
   m_retrievesId = statsType->nameToId("retrieves");
@@ -156,6 +193,13 @@ RegionStats::RegionStats(StatisticsFactory* factory,
       statsType->nameToId("cacheListenerCallsCompleted");
   m_ListenerCallTimeId = statsType->nameToId("cacheListenerCallTime");
   m_clearsId = statsType->nameToId("clears");
+  m_storedValueBytesId = statsType->nameToId("storedValueBytes");
+  m_compressionsId = statsType->nameToId("compressions");
+  m_compressTimeId = statsType->nameToId("compressTime");
+  m_decompressionsId = statsType->nameToId("decompressions");
+  m_decompressTimeId = statsType->nameToId("decompressTime");
+  m_preCompressedBytesId = statsType->nameToId("preCompressedBytes");
+  m_postCompressedBytesId = statsType->nameToId("postCompressedBytes");
 
   m_regionStats = factory->createAtomicStatistics(
       statsType, const_cast<char*>(regionName.c_str()));
@@ -174,6 +218,7 @@ RegionStats::RegionStats(StatisticsFactory* factory,
   m_regionStats->setInt(m_removeAllTimeId, 0);
   m_regionStats->setInt(m_hitsId, 0);
   m_regionStats->setInt(m_missesId, 0);
+  m_regionStats->setInt(m_coalescedGetsId, 0);
   m_regionStats->setInt(m_entriesId, 0);
   m_regionStats->setInt(m_overflowsId, 0);
   m_regionStats->setInt(m_retrievesId, 0);
@@ -185,6 +230,13 @@ RegionStats::RegionStats(StatisticsFactory* factory,
   m_regionStats->setInt(m_ListenerCallsCompletedId, 0);
   m_regionStats->setInt(m_ListenerCallTimeId, 0);
   m_regionStats->setInt(m_clearsId, 0);
+  m_regionStats->setLong(m_storedValueBytesId, 0);
+  m_regionStats->setInt(m_compressionsId, 0);
+  m_regionStats->setLong(m_compressTimeId, 0);
+  m_regionStats->setInt(m_decompressionsId, 0);
+  m_regionStats->setLong(m_decompressTimeId, 0);
+  m_regionStats->setLong(m_preCompressedBytesId, 0);
+  m_regionStats->setLong(m_postCompressedBytesId, 0);
 }
 
 RegionStats::~RegionStats() {
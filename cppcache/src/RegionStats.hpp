@@ -64,6 +64,10 @@ class APACHE_GEODE_EXPORT RegionStats {
 
   inline void incMisses() { m_regionStats->incInt(m_missesId, 1); }
 
+  inline void incCoalescedGets() {
+    m_regionStats->incInt(m_coalescedGetsId, 1);
+  }
+
   inline void incOverflows() { m_regionStats->incInt(m_overflowsId, 1); }
 
   inline void incRetrieves() { m_regionStats->incInt(m_retrievesId, 1); }
@@ -92,6 +96,21 @@ class APACHE_GEODE_EXPORT RegionStats {
 
   inline void updateGetTime() { m_regionStats->incInt(m_clearsId, 1); }
 
+  inline void incStoredValueBytes(int64_t delta) {
+    m_regionStats->incLong(m_storedValueBytesId, delta);
+  }
+
+  inline void incCompressions(int64_t preCompressedBytes,
+                              int64_t postCompressedBytes) {
+    m_regionStats->incInt(m_compressionsId, 1);
+    m_regionStats->incLong(m_preCompressedBytesId, preCompressedBytes);
+    m_regionStats->incLong(m_postCompressedBytesId, postCompressedBytes);
+  }
+
+  inline void incDecompressions() {
+    m_regionStats->incInt(m_decompressionsId, 1);
+  }
+
   inline apache::geode::statistics::Statistics* getStat() {
     return m_regionStats;
   }
@@ -114,6 +133,10 @@ class APACHE_GEODE_EXPORT RegionStats {
 
   inline int32_t getClearsId() { return m_clearsId; }
 
+  inline int32_t getCompressTimeId() { return m_compressTimeId; }
+
+  inline int32_t getDecompressTimeId() { return m_decompressTimeId; }
+
  private:
   apache::geode::statistics::Statistics* m_regionStats;
 
@@ -131,6 +154,7 @@ class APACHE_GEODE_EXPORT RegionStats {
   int32_t m_getAllTimeId;
   int32_t m_hitsId;
   int32_t m_missesId;
+  int32_t m_coalescedGetsId;
   int32_t m_entriesId;
   int32_t m_overflowsId;
   int32_t m_retrievesId;
@@ -142,6 +166,13 @@ class APACHE_GEODE_EXPORT RegionStats {
   int32_t m_ListenerCallsCompletedId;
   int32_t m_ListenerCallTimeId;
   int32_t m_clearsId;
+  int32_t m_storedValueBytesId;
+  int32_t m_compressionsId;
+  int32_t m_compressTimeId;
+  int32_t m_decompressionsId;
+  int32_t m_decompressTimeId;
+  int32_t m_preCompressedBytesId;
+  int32_t m_postCompressedBytesId;
 
   static constexpr const char* STATS_NAME = "RegionStatistics";
   static constexpr const char* STATS_DESC = "Statistics for this region";
@@ -17,6 +17,7 @@
 
 #include "RemoteQuery.hpp"
 
+#include "RemoteSelectResultsStream.hpp"
 #include "ResultSetImpl.hpp"
 #include "StructSetImpl.hpp"
 #include "TcrConnectionManager.hpp"
@@ -119,6 +120,54 @@ std::shared_ptr<SelectResults> RemoteQuery::execute(
   return sr;
 }
 
+std::shared_ptr<SelectResultsStream> RemoteQuery::executeStreaming(
+    std::chrono::milliseconds timeout) {
+  return executeStreaming(nullptr, timeout);
+}
+
+std::shared_ptr<SelectResultsStream> RemoteQuery::executeStreaming(
+    std::shared_ptr<CacheableVector> paramList,
+    std::chrono::milliseconds timeout) {
+  util::PROTOCOL_OPERATION_TIMEOUT_BOUNDS(timeout);
+  auto stream = std::make_shared<RemoteSelectResultsStream>();
+  auto& streamRef = *stream;
+  auto query = shared_from_this();
+  stream->start([query, &streamRef, paramList, timeout] {
+    const char* func = "Query::executeStreaming";
+    GuardUserAttributes gua;
+    if (query->m_authenticatedView != nullptr) {
+      gua.setAuthenticatedView(query->m_authenticatedView);
+    }
+
+    auto tcdm = query->m_tccdm;
+    auto pool = dynamic_cast<ThinClientPoolDM*>(tcdm);
+    if (pool) {
+      pool->getStats().incQueryExecutionId();
+    }
+    bool enableTimeStatistics = tcdm->getConnectionManager()
+                                    .getCacheImpl()
+                                    ->getDistributedSystem()
+                                    .getSystemProperties()
+                                    .getEnableTimeStatistics();
+    int64_t sampleStartNanos =
+        enableTimeStatistics ? Utils::startStatOpTime() : 0;
+
+    TcrMessageReply reply(true, tcdm);
+    StreamingQueryResponse resultCollector(reply, streamRef);
+    reply.setChunkedResultHandler(&resultCollector);
+    GfErrType err =
+        query->executeNoThrow(timeout, reply, func, tcdm, paramList);
+    throwExceptionIfError(func, err);
+
+    if (pool && enableTimeStatistics) {
+      Utils::updateStatOpTime(pool->getStats().getStats(),
+                              pool->getStats().getQueryExecutionTimeId(),
+                              sampleStartNanos);
+    }
+  });
+  return stream;
+}
+
 GfErrType RemoteQuery::executeNoThrow(
     std::chrono::milliseconds timeout, TcrMessageReply& reply, const char* func,
     ThinClientBaseDM* tcdm, std::shared_ptr<CacheableVector> paramList) {
@@ -39,7 +39,9 @@ namespace client {
 
 class ThinClientBaseDM;
 
-class APACHE_GEODE_EXPORT RemoteQuery : public Query {
+class APACHE_GEODE_EXPORT RemoteQuery
+    : public Query,
+      public std::enable_shared_from_this<RemoteQuery> {
   std::string m_queryString;
   std::shared_ptr<RemoteQueryService> m_queryService;
   ThinClientBaseDM* m_tccdm;
@@ -70,6 +72,15 @@ class APACHE_GEODE_EXPORT RemoteQuery : public Query {
       std::chrono::milliseconds timeout, const char* func,
       ThinClientBaseDM* tcdm, std::shared_ptr<CacheableVector> paramList);
 
+  std::shared_ptr<SelectResultsStream> executeStreaming(
+      std::chrono::milliseconds timeout =
+          DEFAULT_QUERY_RESPONSE_TIMEOUT) override;
+
+  std::shared_ptr<SelectResultsStream> executeStreaming(
+      std::shared_ptr<CacheableVector> paramList,
+      std::chrono::milliseconds timeout =
+          DEFAULT_QUERY_RESPONSE_TIMEOUT) override;
+
   // nothrow version of execute()
   GfErrType executeNoThrow(std::chrono::milliseconds timeout,
                            TcrMessageReply& reply, const char* func,
@@ -0,0 +1,170 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "RemoteSelectResultsStream.hpp"
+
+#include <geode/ExceptionTypes.hpp>
+#include <geode/Struct.hpp>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+namespace {
+
+// Chunks buffered ahead of the reader before the query waits.
+const size_t MAX_BUFFERED_CHUNKS = 2;
+
+}  // namespace
+
+RemoteSelectResultsStream::RemoteSelectResultsStream()
+    : m_position(0),
+      m_fieldCount(0),
+      m_delivered(false),
+      m_done(false),
+      m_closed(false) {}
+
+RemoteSelectResultsStream::~RemoteSelectResultsStream() noexcept {
+  {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    m_closed = true;
+  }
+  m_spaceAvailable.notify_all();
+  if (m_producer.joinable()) {
+    m_producer.join();
+  }
+}
+
+void RemoteSelectResultsStream::start(std::function<void()> query) {
+  m_producer = std::thread([this, query] {
+    std::exception_ptr error;
+    try {
+      query();
+    } catch (...) {
+      error = std::current_exception();
+    }
+    complete(error);
+  });
+}
+
+bool RemoteSelectResultsStream::next(std::shared_ptr<Serializable>& result) {
+  std::unique_lock<std::mutex> lock(m_mutex);
+  while (m_position >= m_current.size()) {
+    if (!m_chunks.empty()) {
+      m_current = std::move(m_chunks.front());
+      m_chunks.pop_front();
+      m_position = 0;
+      m_spaceAvailable.notify_one();
+    } else if (m_done) {
+      if (m_error) {
+        std::rethrow_exception(m_error);
+      }
+      return false;
+    } else {
+      m_chunkAvailable.wait(lock);
+    }
+  }
+
+  if (m_fieldCount == 0) {
+    result = std::move(m_current[m_position++]);
+  } else {
+    std::vector<std::shared_ptr<Serializable>> fieldValues(
+        std::make_move_iterator(m_current.begin() + m_position),
+        std::make_move_iterator(m_current.begin() + m_position +
+                                m_fieldCount));
+    m_position += m_fieldCount;
+    result = std::make_shared<Struct>(m_structSet, fieldValues);
+  }
+  m_delivered = true;
+  return true;
+}
+
+void RemoteSelectResultsStream::push(
+    std::vector<std::shared_ptr<Serializable>> values,
+    const std::vector<std::string>& fieldNames) {
+  if (!fieldNames.empty() && values.size() % fieldNames.size() != 0) {
+    throw MessageException(
+        "Query::executeStreaming: Number of values coming from server has to "
+        "be exactly divisible by field count");
+  }
+
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_spaceAvailable.wait(lock, [this] {
+    return m_closed || m_chunks.size() < MAX_BUFFERED_CHUNKS;
+  });
+  if (m_closed || values.empty()) {
+    return;
+  }
+  if (!fieldNames.empty() && !m_structSet) {
+    m_structSet = std::make_shared<StructSetImpl>(CacheableVector::create(),
+                                                  fieldNames);
+    m_fieldCount = fieldNames.size();
+  }
+  m_chunks.push_back(std::move(values));
+  m_chunkAvailable.notify_one();
+}
+
+void RemoteSelectResultsStream::restart() {
+  std::lock_guard<std::mutex> guard(m_mutex);
+  if (m_delivered) {
+    throw IllegalStateException(
+        "Query::executeStreaming: query was retried after results had been "
+        "returned");
+  }
+  m_chunks.clear();
+  m_current.clear();
+  m_position = 0;
+  m_spaceAvailable.notify_all();
+}
+
+void RemoteSelectResultsStream::complete(std::exception_ptr error) {
+  {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    m_done = true;
+    m_error = error;
+  }
+  m_chunkAvailable.notify_all();
+}
+
+StreamingQueryResponse::StreamingQueryResponse(
+    TcrMessage& msg, RemoteSelectResultsStream& stream)
+    : ChunkedQueryResponse(msg), m_stream(stream) {}
+
+void StreamingQueryResponse::handleChunk(const uint8_t* chunk,
+                                         int32_t chunkLen,
+                                         uint8_t isLastChunkWithSecurity,
+                                         const CacheImpl* cacheImpl) {
+  ChunkedQueryResponse::handleChunk(chunk, chunkLen, isLastChunkWithSecurity,
+                                    cacheImpl);
+
+  auto& values = *getQueryResults();
+  m_stream.push(
+      std::vector<std::shared_ptr<Serializable>>(
+          std::make_move_iterator(values.begin()),
+          std::make_move_iterator(values.end())),
+      getStructFieldNames());
+  values.clear();
+}
+
+void StreamingQueryResponse::reset() {
+  ChunkedQueryResponse::reset();
+  m_stream.restart();
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
@@ -0,0 +1,130 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_REMOTESELECTRESULTSSTREAM_H_
+#define GEODE_REMOTESELECTRESULTSSTREAM_H_
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <geode/SelectResultsStream.hpp>
+
+#include "StructSetImpl.hpp"
+#include "ThinClientRegion.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * SelectResultsStream fed by a query running on a thread of its own. The
+ * query hands over each deserialized chunk and blocks while the reader is
+ * more than a couple of chunks behind, which in turn stops it from reading
+ * the rest of the reply off the connection. Since a stream may go unread
+ * for as long as the application likes, the query never runs on the cache
+ * thread pool.
+ */
+class RemoteSelectResultsStream : public SelectResultsStream {
+ public:
+  RemoteSelectResultsStream();
+
+  RemoteSelectResultsStream(const RemoteSelectResultsStream&) = delete;
+
+  RemoteSelectResultsStream& operator=(const RemoteSelectResultsStream&) =
+      delete;
+
+  ~RemoteSelectResultsStream() noexcept override;
+
+  bool next(std::shared_ptr<Serializable>& result) override;
+
+  /**
+   * Runs query on a new thread. Whatever it throws is rethrown to the reader
+   * once all results received before the failure have been read. The
+   * stream waits for the query to end when destroyed.
+   */
+  void start(std::function<void()> query);
+
+  /**
+   * Hands over the values of one chunk, waiting while the reader is behind.
+   * Values are discarded once the stream has been destroyed.
+   */
+  void push(std::vector<std::shared_ptr<Serializable>> values,
+            const std::vector<std::string>& fieldNames);
+
+  /**
+   * Drops values not yet read when the query is retried on another server.
+   *
+   * @throws IllegalStateException if results have already been read.
+   */
+  void restart();
+
+ private:
+  void complete(std::exception_ptr error);
+
+  std::mutex m_mutex;
+  std::condition_variable m_chunkAvailable;
+  std::condition_variable m_spaceAvailable;
+  std::deque<std::vector<std::shared_ptr<Serializable>>> m_chunks;
+  std::vector<std::shared_ptr<Serializable>> m_current;
+  size_t m_position;
+  std::shared_ptr<StructSetImpl> m_structSet;
+  size_t m_fieldCount;
+  bool m_delivered;
+  bool m_done;
+  bool m_closed;
+  std::exception_ptr m_error;
+  std::thread m_producer;
+};
+
+/**
+ * Query response handler passing each chunk on to a
+ * RemoteSelectResultsStream as soon as it has been deserialized. Chunks are
+ * handled on the thread reading the reply, so waiting for a slow reader
+ * never holds up the chunk processor thread shared by the pool.
+ */
+class StreamingQueryResponse : public ChunkedQueryResponse {
+ public:
+  StreamingQueryResponse(TcrMessage& msg, RemoteSelectResultsStream& stream);
+
+  ~StreamingQueryResponse() override = default;
+
+  void handleChunk(const uint8_t* chunk, int32_t chunkLen,
+                   uint8_t isLastChunkWithSecurity,
+                   const CacheImpl* cacheImpl) override;
+
+  void reset() override;
+
+  bool handleChunksInReader() const override { return true; }
+
+ private:
+  RemoteSelectResultsStream& m_stream;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_REMOTESELECTRESULTSSTREAM_H_
@@ -224,16 +224,12 @@ std::shared_ptr<Serializable> SerializationRegistry::deserialize(
       break;
   }
 
-  TypeFactoryMethod createType = nullptr;
+  auto obj = theTypeMap_.createDataSerializablePrimitive(dsCode);
 
-  theTypeMap_.findDataSerializablePrimitive(dsCode, createType);
-
-  if (createType == nullptr) {
+  if (obj == nullptr) {
     throw IllegalStateException("Unregistered type in deserialization");
   }
 
-  std::shared_ptr<Serializable> obj(createType());
-
   deserialize(input, obj);
 
   return obj;
@@ -308,17 +304,13 @@ SerializationRegistry::deserializeDataSerializableFixedId(DataInput& input,
       throw IllegalStateException("Invalid fixed ID");
   }
 
-  TypeFactoryMethod createType = nullptr;
+  auto obj =
+      theTypeMap_.createDataSerializableFixedId(static_cast<DSFid>(fixedId));
 
-  theTypeMap_.findDataSerializableFixedId(static_cast<DSFid>(fixedId),
-                                          createType);
-
-  if (createType == nullptr) {
+  if (obj == nullptr) {
     throw IllegalStateException("Unregistered type in deserialization");
   }
 
-  std::shared_ptr<Serializable> obj(createType());
-
   deserialize(input, obj);
 
   return obj;
@@ -326,17 +318,18 @@ SerializationRegistry::deserializeDataSerializableFixedId(DataInput& input,
 
 void SerializationRegistry::deserialize(
     DataInput& input, const std::shared_ptr<Serializable>& obj) const {
+  // plain casts, the shared_ptr casts would each touch the reference count
   if (!obj) {
     // nothing to read
-  } else if (const auto&& dataSerializableInternal =
-                 std::dynamic_pointer_cast<DataSerializableInternal>(obj)) {
+  } else if (const auto dataSerializablePrimitive =
+                 dynamic_cast<DataSerializablePrimitive*>(obj.get())) {
+    dataSerializablePrimitive->fromData(input);
+  } else if (const auto dataSerializableInternal =
+                 dynamic_cast<DataSerializableInternal*>(obj.get())) {
     dataSerializableInternal->fromData(input);
-  } else if (const auto&& dataSerializableFixedId =
-                 std::dynamic_pointer_cast<DataSerializableFixedId>(obj)) {
+  } else if (const auto dataSerializableFixedId =
+                 dynamic_cast<DataSerializableFixedId*>(obj.get())) {
     dataSerializableFixedId->fromData(input);
-  } else if (const auto&& dataSerializablePrimitive =
-                 std::dynamic_pointer_cast<DataSerializablePrimitive>(obj)) {
-    dataSerializablePrimitive->fromData(input);
   } else {
     throw UnsupportedOperationException("Serialization type not implemented.");
   }
@@ -459,20 +452,47 @@ void TheTypeMap::findDataSerializable(int32_t id,
 
 void TheTypeMap::findDataSerializableFixedId(DSFid dsfid,
                                              TypeFactoryMethod& func) const {
-  const std::lock_guard<std::mutex> guard(dataSerializableFixedIdMapMutex_);
-  const auto& found = dataSerializableFixedIdMap_.find(dsfid);
-  if (found != dataSerializableFixedIdMap_.end()) {
-    func = found->second;
-  }
+  dataSerializableFixedIdMap_.read(
+      [dsfid, &func](const DataSerializableFixedIdMap& map) {
+        const auto& found = map.find(dsfid);
+        if (found != map.end()) {
+          func = found->second;
+        }
+      });
+}
+
+std::shared_ptr<Serializable> TheTypeMap::createDataSerializableFixedId(
+    DSFid dsfid) const {
+  return dataSerializableFixedIdMap_.read(
+      [dsfid](const DataSerializableFixedIdMap& map)
+          -> std::shared_ptr<Serializable> {
+        const auto& found = map.find(dsfid);
+        if (found != map.end()) {
+          return found->second();
+        }
+        return nullptr;
+      });
 }
 
 void TheTypeMap::findDataSerializablePrimitive(DSCode dsCode,
                                                TypeFactoryMethod& func) const {
-  const std::lock_guard<std::mutex> guard(dataSerializablePrimitiveMapMutex_);
-  const auto& found = dataSerializablePrimitiveMap_.find(dsCode);
-  if (found != dataSerializablePrimitiveMap_.end()) {
-    func = found->second;
-  }
+  dataSerializablePrimitives_.read(
+      [dsCode, &func](const DataSerializablePrimitiveTable& table) {
+        func = table[static_cast<uint8_t>(dsCode)];
+      });
+}
+
+std::shared_ptr<Serializable> TheTypeMap::createDataSerializablePrimitive(
+    DSCode dsCode) const {
+  return dataSerializablePrimitives_.read(
+      [dsCode](const DataSerializablePrimitiveTable& table)
+          -> std::shared_ptr<Serializable> {
+        const auto& createType = table[static_cast<uint8_t>(dsCode)];
+        if (createType) {
+          return createType();
+        }
+        return nullptr;
+      });
 }
 
 void TheTypeMap::bindDataSerializable(TypeFactoryMethod func, int32_t id) {
@@ -507,18 +527,26 @@ void TheTypeMap::unbindDataSerializable(int32_t id) {
 void TheTypeMap::bindDataSerializablePrimitive(TypeFactoryMethod func,
                                                DSCode dsCode) {
   const std::lock_guard<std::mutex> guard(dataSerializablePrimitiveMapMutex_);
-  const auto& result = dataSerializablePrimitiveMap_.emplace(dsCode, func);
-  if (!result.second) {
+  TypeFactoryMethod found;
+  findDataSerializablePrimitive(dsCode, found);
+  if (found) {
     LOGERROR("A class with DSCode %d is already registered.", dsCode);
     throw IllegalStateException(
         "A class with given DSCode is already registered.");
   }
+  dataSerializablePrimitives_.update(
+      [dsCode, &func](DataSerializablePrimitiveTable& table) {
+        table[static_cast<uint8_t>(dsCode)] = std::move(func);
+      });
 }
 
 void TheTypeMap::rebindDataSerializablePrimitive(DSCode dsCode,
                                                  TypeFactoryMethod func) {
   const std::lock_guard<std::mutex> guard(dataSerializablePrimitiveMapMutex_);
-  dataSerializablePrimitiveMap_[dsCode] = func;
+  dataSerializablePrimitives_.update(
+      [dsCode, &func](DataSerializablePrimitiveTable& table) {
+        table[static_cast<uint8_t>(dsCode)] = std::move(func);
+      });
 }
 
 void TheTypeMap::bindDataSerializableFixedId(TypeFactoryMethod func) {
@@ -535,23 +563,28 @@ void TheTypeMap::bindDataSerializableFixedId(TypeFactoryMethod func) {
   }
 
   const std::lock_guard<std::mutex> guard(dataSerializableFixedIdMapMutex_);
-  const auto& result = dataSerializableFixedIdMap_.emplace(id, func);
-  if (!result.second) {
+  TypeFactoryMethod found;
+  findDataSerializableFixedId(id, found);
+  if (found) {
     LOGERROR("A fixed class with ID %d is already registered.", id);
     throw IllegalStateException(
         "A fixed class with given ID is already registered.");
   }
+  dataSerializableFixedIdMap_.update(
+      [id, &func](DataSerializableFixedIdMap& map) { map.emplace(id, func); });
 }
 
 void TheTypeMap::rebindDataSerializableFixedId(internal::DSFid id,
                                                TypeFactoryMethod func) {
   const std::lock_guard<std::mutex> guard(dataSerializableFixedIdMapMutex_);
-  dataSerializableFixedIdMap_[id] = func;
+  dataSerializableFixedIdMap_.update(
+      [id, &func](DataSerializableFixedIdMap& map) { map[id] = func; });
 }
 
 void TheTypeMap::unbindDataSerializableFixedId(internal::DSFid id) {
   const std::lock_guard<std::mutex> guard(dataSerializableFixedIdMapMutex_);
-  dataSerializableFixedIdMap_.erase(id);
+  dataSerializableFixedIdMap_.update(
+      [id](DataSerializableFixedIdMap& map) { map.erase(id); });
 }
 
 void TheTypeMap::bindPdxSerializable(TypeFactoryMethodPdx func) {
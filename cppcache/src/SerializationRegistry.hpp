@@ -20,6 +20,7 @@
 #ifndef GEODE_SERIALIZATIONREGISTRY_H_
 #define GEODE_SERIALIZATIONREGISTRY_H_
 
+#include <array>
 #include <functional>
 #include <iostream>
 #include <memory>
@@ -42,6 +43,7 @@
 
 #include "MemberListForVersionStamp.hpp"
 #include "config.h"
+#include "util/concurrent/snapshot.hpp"
 
 namespace std {
 
@@ -72,11 +74,21 @@ namespace client {
 using internal::DataSerializableInternal;
 using internal::DataSerializablePrimitive;
 
+/**
+ * Built-in and fixed id types are looked up on every deserialization, so
+ * their factories are read without locking. Primitives live in a table
+ * indexed by DSCode, fixed ids in a map. Both are immutable snapshots that
+ * writers copy and replace as a whole on every change.
+ */
 class TheTypeMap {
-  std::unordered_map<internal::DSCode, TypeFactoryMethod>
-      dataSerializablePrimitiveMap_;
+  typedef std::array<TypeFactoryMethod, 256> DataSerializablePrimitiveTable;
+  typedef std::unordered_map<internal::DSFid, TypeFactoryMethod>
+      DataSerializableFixedIdMap;
+
+  util::concurrent::snapshot<DataSerializablePrimitiveTable>
+      dataSerializablePrimitives_;
   std::unordered_map<int32_t, TypeFactoryMethod> dataSerializableMap_;
-  std::unordered_map<internal::DSFid, TypeFactoryMethod>
+  util::concurrent::snapshot<DataSerializableFixedIdMap>
       dataSerializableFixedIdMap_;
   std::unordered_map<std::string, TypeFactoryMethodPdx> pdxSerializableMap_;
   mutable std::mutex dataSerializablePrimitiveMapMutex_;
@@ -107,6 +119,13 @@ class TheTypeMap {
   void findDataSerializableFixedId(internal::DSFid id,
                                    TypeFactoryMethod& func) const;
 
+  /**
+   * Returns a new instance of the type registered for <code>id</code> or
+   * nullptr if there is none.
+   */
+  std::shared_ptr<Serializable> createDataSerializableFixedId(
+      internal::DSFid id) const;
+
   void bindDataSerializableFixedId(TypeFactoryMethod func);
 
   void rebindDataSerializableFixedId(internal::DSFid id,
@@ -127,6 +146,13 @@ class TheTypeMap {
   void findDataSerializablePrimitive(DSCode dsCode,
                                      TypeFactoryMethod& func) const;
 
+  /**
+   * Returns a new instance of the type registered for <code>dsCode</code> or
+   * nullptr if there is none.
+   */
+  std::shared_ptr<Serializable> createDataSerializablePrimitive(
+      DSCode dsCode) const;
+
   void bindDataSerializablePrimitive(TypeFactoryMethod func, DSCode id);
 
   void rebindDataSerializablePrimitive(DSCode dsCode, TypeFactoryMethod func);
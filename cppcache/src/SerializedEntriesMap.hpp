@@ -0,0 +1,235 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_SERIALIZEDENTRIESMAP_H_
+#define GEODE_SERIALIZEDENTRIESMAP_H_
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <geode/Delta.hpp>
+#include <geode/ExceptionTypes.hpp>
+#include <geode/RegionAttributes.hpp>
+
+#include "EntriesMap.hpp"
+#include "RegionInternal.hpp"
+#include "StoredValue.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * @brief Entries map keeping its values in serialized or compressed form.
+ *
+ * Values are converted to their StoredValue on the way into the underlying
+ * map <code>TBase</code> and back into objects on the way out. Values
+ * displaced from the map, which mostly end up in events, are handed out in
+ * their stored form and only deserialized if read, see load. Since LRU
+ * accounting happens below, heap LRU counts the stored bytes.
+ */
+template <class TBase>
+class SerializedEntriesMap : public TBase {
+ public:
+  template <class... Args>
+  SerializedEntriesMap(RegionInternal* region,
+                       const RegionAttributes& attributes, Args&&... args)
+      : TBase(std::forward<Args>(args)...),
+        m_codec(region, attributes.getValueStorage(),
+                attributes.getDeserializedValueCacheSize()) {}
+
+  ~SerializedEntriesMap() override = default;
+
+  SerializedEntriesMap(const SerializedEntriesMap&) = delete;
+  SerializedEntriesMap& operator=(const SerializedEntriesMap&) = delete;
+
+  void clear() override {
+    TBase::clear();
+    m_codec.cleared();
+  }
+
+  GfErrType put(const std::shared_ptr<CacheableKey>& key,
+                std::shared_ptr<Cacheable>& newValue,
+                std::shared_ptr<MapEntryImpl>& me,
+                std::shared_ptr<Cacheable>& oldValue, int updateCount,
+                int destroyTracker, std::shared_ptr<VersionTag> versionTag,
+                bool& isUpdate = EntriesMap::boolVal,
+                DataInput* delta = nullptr) override {
+    if (delta != nullptr) {
+      auto err = applyDelta(key, newValue, *delta, versionTag, updateCount);
+      if (err != GF_NOERR) {
+        return err;
+      }
+    }
+
+    auto stored = m_codec.store(newValue);
+    auto err = TBase::put(key, stored, me, oldValue, updateCount,
+                          destroyTracker, versionTag, isUpdate);
+    if (err == GF_NOERR) {
+      m_codec.replaced(stored, oldValue);
+    } else if (delta != nullptr && err == GF_CACHE_ENTRY_UPDATED) {
+      // the delta was applied to a value replaced meanwhile
+      err = GF_INVALID_DELTA;
+    }
+    return err;
+  }
+
+  GfErrType invalidate(const std::shared_ptr<CacheableKey>& key,
+                       std::shared_ptr<MapEntryImpl>& me,
+                       std::shared_ptr<Cacheable>& oldValue,
+                       std::shared_ptr<VersionTag> versionTag) override {
+    auto err = TBase::invalidate(key, me, oldValue, versionTag);
+    if (err == GF_NOERR) {
+      m_codec.replaced(nullptr, oldValue);
+    }
+    return err;
+  }
+
+  GfErrType create(const std::shared_ptr<CacheableKey>& key,
+                   const std::shared_ptr<Cacheable>& newValue,
+                   std::shared_ptr<MapEntryImpl>& me,
+                   std::shared_ptr<Cacheable>& oldValue, int updateCount,
+                   int destroyTracker,
+                   std::shared_ptr<VersionTag> versionTag) override {
+    auto stored = m_codec.store(newValue);
+    auto err = TBase::create(key, stored, me, oldValue, updateCount,
+                             destroyTracker, versionTag);
+    if (err == GF_NOERR) {
+      m_codec.replaced(stored, oldValue);
+    }
+    return err;
+  }
+
+  bool get(const std::shared_ptr<CacheableKey>& key,
+           std::shared_ptr<Cacheable>& value,
+           std::shared_ptr<MapEntryImpl>& me) override {
+    auto found = TBase::get(key, value, me);
+    value = m_codec.load(value);
+    return found;
+  }
+
+  void getEntry(const std::shared_ptr<CacheableKey>& key,
+                std::shared_ptr<MapEntryImpl>& result,
+                std::shared_ptr<Cacheable>& value) const override {
+    TBase::getEntry(key, result, value);
+    value = m_codec.load(value);
+  }
+
+  GfErrType remove(const std::shared_ptr<CacheableKey>& key,
+                   std::shared_ptr<Cacheable>& result,
+                   std::shared_ptr<MapEntryImpl>& me, int updateCount,
+                   std::shared_ptr<VersionTag> versionTag,
+                   bool afterRemote) override {
+    auto err =
+        TBase::remove(key, result, me, updateCount, versionTag, afterRemote);
+    if (err == GF_NOERR) {
+      m_codec.replaced(nullptr, result);
+    }
+    return err;
+  }
+
+  void getEntries(
+      std::vector<std::shared_ptr<RegionEntry>>& result) const override {
+    TBase::getEntries(result);
+    for (auto& entry : result) {
+      auto value = entry->getValue();
+      if (std::dynamic_pointer_cast<StoredValue>(value)) {
+        entry = this->m_region->createRegionEntry(entry->getKey(),
+                                                  m_codec.load(value));
+      }
+    }
+  }
+
+  void getValues(
+      std::vector<std::shared_ptr<Cacheable>>& result) const override {
+    TBase::getValues(result);
+    for (auto& value : result) {
+      value = m_codec.load(value);
+    }
+  }
+
+  std::shared_ptr<Cacheable> load(
+      const std::shared_ptr<Cacheable>& value) const override {
+    return m_codec.load(value);
+  }
+
+ private:
+  mutable StoredValueCodec m_codec;
+
+  /**
+   * Applies <code>delta</code> to a copy of the current value of the entry
+   * and hands the result back through <code>newValue</code>, as MapSegment
+   * does for entries holding objects.
+   *
+   * Unlike there, the delta is applied outside the segment. Without
+   * concurrency checks the entry is tracked through
+   * <code>updateCount</code>, so that the put of the result fails if the
+   * entry is updated meanwhile. With them, the version tag of the delta has
+   * to follow the version of the value it is applied to, and the put of the
+   * result fails once a later version has been stored.
+   */
+  GfErrType applyDelta(const std::shared_ptr<CacheableKey>& key,
+                       std::shared_ptr<Cacheable>& newValue, DataInput& delta,
+                       const std::shared_ptr<VersionTag>& versionTag,
+                       int& updateCount) {
+    std::shared_ptr<Cacheable> stored;
+    auto tracked = TBase::addTrackerForEntry(key, stored, false, false, true);
+    if (tracked < 0) {
+      std::shared_ptr<MapEntryImpl> me;
+      TBase::getEntry(key, me, stored);
+      if (me != nullptr && versionTag != nullptr &&
+          this->m_region->getAttributes().getConcurrencyChecksEnabled() &&
+          me->getVersionStamp().processVersionTag(this->m_region, key,
+                                                  versionTag, true) !=
+              GF_NOERR) {
+        return GF_INVALID_DELTA;
+      }
+    }
+
+    auto valueWithDelta =
+        std::dynamic_pointer_cast<Delta>(m_codec.load(stored, false));
+    GfErrType err = GF_NOERR;
+    if (valueWithDelta == nullptr) {
+      err = GF_INVALID_DELTA;
+    } else {
+      try {
+        valueWithDelta->fromDelta(delta);
+        newValue = std::dynamic_pointer_cast<Cacheable>(valueWithDelta);
+      } catch (InvalidDeltaException&) {
+        err = GF_INVALID_DELTA;
+      }
+    }
+
+    if (tracked >= 0) {
+      if (err == GF_NOERR) {
+        updateCount = tracked;
+      } else {
+        TBase::removeTrackerForEntry(key);
+      }
+    }
+    return err;
+  }
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_SERIALIZEDENTRIESMAP_H_
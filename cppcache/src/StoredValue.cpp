@@ -0,0 +1,221 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "StoredValue.hpp"
+
+#include <geode/DataInput.hpp>
+#include <geode/DataOutput.hpp>
+#include <geode/ExceptionTypes.hpp>
+
+#include "CacheImpl.hpp"
+#include "CacheableToken.hpp"
+#include "RegionInternal.hpp"
+#include "Utils.hpp"
+#include "util/Lz4.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+std::string StoredValue::toString() const {
+  return "StoredValue(" + std::to_string(bytes_.size()) + " of " +
+         std::to_string(serializedLength()) + " bytes)";
+}
+
+std::shared_ptr<Cacheable> StoredValue::deserialize(const CacheImpl& cacheImpl,
+                                                    Pool* pool) const {
+  if (!isCompressed()) {
+    return cacheImpl.createDataInput(bytes_.data(), bytes_.size(), pool)
+        .readObject();
+  }
+
+  auto serialized = decompress();
+  return cacheImpl.createDataInput(serialized.data(), serialized.size(), pool)
+      .readObject();
+}
+
+std::vector<uint8_t> StoredValue::decompress() const {
+  std::vector<uint8_t> serialized(serializedLength_);
+  if (!internal::Lz4::decompress(bytes_.data(), bytes_.size(),
+                                 serialized.data(), serialized.size())) {
+    throw FatalInternalException("StoredValue: corrupt compressed value");
+  }
+  return serialized;
+}
+
+StoredValueCodec::StoredValueCodec(RegionInternal* region,
+                                   ValueStorageType valueStorage,
+                                   uint32_t cacheSize)
+    : region_(region),
+      compress_(valueStorage == ValueStorageType::COMPRESSED),
+      enableTimeStatistics_(region->getCacheImpl()
+                                ->getDistributedSystem()
+                                .getSystemProperties()
+                                .getEnableTimeStatistics()),
+      storedBytes_(0),
+      cache_(cacheSize),
+      cacheNext_(0) {}
+
+std::shared_ptr<Cacheable> StoredValueCodec::store(
+    const std::shared_ptr<Cacheable>& value) const {
+  if (value == nullptr || CacheableToken::isToken(value)) {
+    return value;
+  }
+
+  if (auto stored = std::dynamic_pointer_cast<StoredValue>(value)) {
+    if (compress_ && !stored->isCompressed()) {
+      if (auto compressed =
+              compress(stored->bytes().data(), stored->bytes().size())) {
+        return compressed;
+      }
+    }
+    return value;
+  }
+
+  auto output =
+      region_->getCacheImpl()->createDataOutput(region_->getPool().get());
+  output.writeObject(value);
+  size_t length = 0;
+  auto buffer = output.getBuffer(&length);
+
+  if (compress_) {
+    if (auto compressed = compress(buffer, length)) {
+      return compressed;
+    }
+  }
+
+  return std::make_shared<StoredValue>(
+      std::vector<uint8_t>(buffer, buffer + length), 0);
+}
+
+std::shared_ptr<Cacheable> StoredValueCodec::load(
+    const std::shared_ptr<Cacheable>& value, bool shared) {
+  auto stored = std::dynamic_pointer_cast<StoredValue>(value);
+  if (!stored) {
+    return value;
+  }
+
+  if (!shared || cache_.empty()) {
+    return deserialize(*stored);
+  }
+
+  if (auto cached = std::atomic_load(&stored->deserialized_)) {
+    return cached;
+  }
+
+  auto result = deserialize(*stored);
+  std::shared_ptr<Cacheable> expected;
+  if (std::atomic_compare_exchange_strong(&stored->deserialized_, &expected,
+                                          result)) {
+    cache(stored);
+    return result;
+  }
+  // another reader was faster
+  return expected;
+}
+
+void StoredValueCodec::replaced(const std::shared_ptr<Cacheable>& added,
+                                const std::shared_ptr<Cacheable>& removed) {
+  int64_t delta = 0;
+  if (auto stored = std::dynamic_pointer_cast<StoredValue>(added)) {
+    delta += stored->bytes().size();
+  }
+  if (auto stored = std::dynamic_pointer_cast<StoredValue>(removed)) {
+    delta -= stored->bytes().size();
+  }
+  if (delta != 0) {
+    updateStoredBytes(delta);
+  }
+}
+
+void StoredValueCodec::cleared() {
+  auto cleared = storedBytes_.exchange(0);
+  if (auto stats = region_->getRegionStats()) {
+    stats->incStoredValueBytes(-cleared);
+  }
+}
+
+std::shared_ptr<StoredValue> StoredValueCodec::compress(const uint8_t* buffer,
+                                                       size_t length) const {
+  // only worth keeping if it shrinks
+  if (length <= 1) {
+    return nullptr;
+  }
+  auto stats = region_->getRegionStats();
+  int64_t sampleStartNanos =
+      stats && enableTimeStatistics_ ? Utils::startStatOpTime() : 0;
+  std::vector<uint8_t> compressed(length - 1);
+  auto compressedLength = internal::Lz4::compress(
+      buffer, length, compressed.data(), compressed.size());
+  if (stats) {
+    if (enableTimeStatistics_) {
+      Utils::updateStatOpTime(stats->getStat(), stats->getCompressTimeId(),
+                              sampleStartNanos);
+    }
+    // a value that does not shrink is kept as is
+    stats->incCompressions(length,
+                           compressedLength ? compressedLength : length);
+  }
+  if (compressedLength == 0) {
+    return nullptr;
+  }
+  compressed.resize(compressedLength);
+  compressed.shrink_to_fit();
+  return std::make_shared<StoredValue>(std::move(compressed), length);
+}
+
+std::shared_ptr<Cacheable> StoredValueCodec::deserialize(
+    const StoredValue& stored) const {
+  auto cacheImpl = region_->getCacheImpl();
+  auto pool = region_->getPool().get();
+  auto stats = region_->getRegionStats();
+  if (!stored.isCompressed() || !stats) {
+    return stored.deserialize(*cacheImpl, pool);
+  }
+
+  int64_t sampleStartNanos =
+      enableTimeStatistics_ ? Utils::startStatOpTime() : 0;
+  auto serialized = stored.decompress();
+  if (enableTimeStatistics_) {
+    Utils::updateStatOpTime(stats->getStat(), stats->getDecompressTimeId(),
+                            sampleStartNanos);
+  }
+  stats->incDecompressions();
+  return cacheImpl->createDataInput(serialized.data(), serialized.size(), pool)
+      .readObject();
+}
+
+void StoredValueCodec::cache(const std::shared_ptr<StoredValue>& value) {
+  std::lock_guard<decltype(cacheMutex_)> lock(cacheMutex_);
+  auto& slot = cache_[cacheNext_];
+  if (auto evicted = slot.lock()) {
+    std::atomic_store(&evicted->deserialized_, std::shared_ptr<Cacheable>());
+  }
+  slot = value;
+  cacheNext_ = (cacheNext_ + 1) % cache_.size();
+}
+
+void StoredValueCodec::updateStoredBytes(int64_t delta) {
+  storedBytes_ += delta;
+  if (auto stats = region_->getRegionStats()) {
+    stats->incStoredValueBytes(delta);
+  }
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
@@ -0,0 +1,164 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_STOREDVALUE_H_
+#define GEODE_STOREDVALUE_H_
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <geode/Serializable.hpp>
+#include <geode/ValueStorageType.hpp>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+class CacheImpl;
+class Pool;
+class RegionInternal;
+
+/**
+ * The serialized, possibly compressed, form of a value kept in the entry of
+ * a region that does not store objects.
+ *
+ * Values received from the server for such a region travel in this form
+ * from the message to the entries map, so that they are only deserialized
+ * once they are read. Outside the entries map they are resolved by
+ * EntriesMap::load or, in events, by EntryEvent.
+ */
+class StoredValue : public Serializable {
+ public:
+  /**
+   * @param bytes the serialized value, or its LZ4 block if
+   * <code>serializedLength</code> is not 0
+   * @param serializedLength the length of the uncompressed serialized value
+   */
+  StoredValue(std::vector<uint8_t> bytes, size_t serializedLength)
+      : bytes_(std::move(bytes)), serializedLength_(serializedLength) {}
+
+  ~StoredValue() noexcept override = default;
+
+  const std::vector<uint8_t>& bytes() const { return bytes_; }
+
+  bool isCompressed() const { return serializedLength_ != 0; }
+
+  size_t serializedLength() const {
+    return isCompressed() ? serializedLength_ : bytes_.size();
+  }
+
+  size_t objectSize() const override {
+    return sizeof(StoredValue) + bytes_.capacity();
+  }
+
+  std::string toString() const override;
+
+  /**
+   * Returns a new object read from the serialized value.
+   *
+   * @throws FatalInternalException if the compressed value is corrupt
+   */
+  std::shared_ptr<Cacheable> deserialize(const CacheImpl& cacheImpl,
+                                         Pool* pool) const;
+
+  /**
+   * Returns the uncompressed serialized value of a compressed value.
+   *
+   * @throws FatalInternalException if the compressed value is corrupt
+   */
+  std::vector<uint8_t> decompress() const;
+
+ private:
+  const std::vector<uint8_t> bytes_;
+  const size_t serializedLength_;
+
+  // recently deserialized value, see StoredValueCodec
+  std::shared_ptr<Cacheable> deserialized_;
+
+  friend class StoredValueCodec;
+};
+
+/**
+ * Converts the values of a region between their object and their stored
+ * form and keeps the region's statistics of stored bytes and compression.
+ *
+ * The most recently deserialized values are kept by their StoredValue so
+ * that repeated reads of a hot entry deserialize it only once. A ring of
+ * the last <code>cacheSize</code> of them pushes out the oldest.
+ */
+class StoredValueCodec {
+ public:
+  StoredValueCodec(RegionInternal* region, ValueStorageType valueStorage,
+                   uint32_t cacheSize);
+
+  StoredValueCodec(const StoredValueCodec&) = delete;
+  StoredValueCodec& operator=(const StoredValueCodec&) = delete;
+
+  /**
+   * Returns the stored form of <code>value</code>; tokens and nullptr are
+   * returned as they are. A StoredValue received from the server is only
+   * compressed if the region asks for it.
+   */
+  std::shared_ptr<Cacheable> store(
+      const std::shared_ptr<Cacheable>& value) const;
+
+  /**
+   * Returns the object form of a value read from the entries map. Unless
+   * <code>shared</code> is false the object may be the one handed out to
+   * other readers.
+   */
+  std::shared_ptr<Cacheable> load(const std::shared_ptr<Cacheable>& value,
+                                  bool shared = true);
+
+  /**
+   * Records <code>added</code> replacing <code>removed</code> in the
+   * entries map.
+   */
+  void replaced(const std::shared_ptr<Cacheable>& added,
+                const std::shared_ptr<Cacheable>& removed);
+
+  /**
+   * Records all stored values having been removed.
+   */
+  void cleared();
+
+ private:
+  RegionInternal* region_;
+  const bool compress_;
+  const bool enableTimeStatistics_;
+  std::atomic<int64_t> storedBytes_;
+
+  std::mutex cacheMutex_;
+  std::vector<std::weak_ptr<StoredValue>> cache_;
+  size_t cacheNext_;
+
+  std::shared_ptr<StoredValue> compress(const uint8_t* buffer,
+                                       size_t length) const;
+  std::shared_ptr<Cacheable> deserialize(const StoredValue& stored) const;
+  void cache(const std::shared_ptr<StoredValue>& value);
+  void updateStoredBytes(int64_t delta);
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_STOREDVALUE_H_
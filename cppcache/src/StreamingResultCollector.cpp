@@ -0,0 +1,380 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include <geode/ExceptionTypes.hpp>
+#include <geode/StreamingResultCollector.hpp>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+namespace {
+
+const size_t MAX_SHARDS = 64;
+const size_t CACHE_LINE_SIZE = 64;
+
+struct ResultNode {
+  ResultNode(const std::shared_ptr<Cacheable>& result, uint64_t generation)
+      : next(nullptr), value(result), generation(generation) {}
+
+  std::atomic<ResultNode*> next;
+  std::shared_ptr<Cacheable> value;
+  const uint64_t generation;
+};
+
+/**
+ * Unbounded multi producer, single consumer queue. Producers only exchange
+ * the head, the consumer alone follows the links from the tail. The node at
+ * the tail has already been consumed and serves as the stub.
+ */
+class ResultShard {
+ public:
+  ResultShard() : head_(&stub_), tail_(&stub_) {}
+
+  ~ResultShard() {
+    std::shared_ptr<Cacheable> value;
+    uint64_t generation;
+    while (pop(value, generation)) {
+    }
+    if (tail_ != &stub_) {
+      delete tail_;
+    }
+  }
+
+  ResultShard(const ResultShard&) = delete;
+  ResultShard& operator=(const ResultShard&) = delete;
+
+  void push(ResultNode* node) {
+    auto prev = head_.exchange(node, std::memory_order_acq_rel);
+    prev->next.store(node, std::memory_order_release);
+  }
+
+  /**
+   * Returns false if the queue is empty or its next node has not been
+   * linked in by its producer yet.
+   */
+  bool pop(std::shared_ptr<Cacheable>& value, uint64_t& generation) {
+    auto tail = tail_;
+    auto next = tail->next.load(std::memory_order_acquire);
+    if (next == nullptr) {
+      return false;
+    }
+
+    value = std::move(next->value);
+    generation = next->generation;
+    tail_ = next;
+    if (tail != &stub_) {
+      delete tail;
+    }
+    return true;
+  }
+
+ private:
+  std::atomic<ResultNode*> head_;
+  char headPadding_[CACHE_LINE_SIZE - sizeof(std::atomic<ResultNode*>)];
+  ResultNode* tail_;
+  ResultNode stub_{nullptr, 0};
+  char tailPadding_[CACHE_LINE_SIZE];
+};
+
+size_t shardCount() {
+  size_t count = 1;
+  auto threads = static_cast<size_t>(std::thread::hardware_concurrency());
+  while (count < threads && count < MAX_SHARDS) {
+    count <<= 1;
+  }
+  return count;
+}
+
+/**
+ * Each producing thread sticks to one shard so results of one server keep
+ * their order.
+ */
+size_t threadShardIndex() {
+  static std::atomic<size_t> nextIndex(0);
+  static thread_local size_t index = nextIndex++;
+  return index;
+}
+
+}  // namespace
+
+class StreamingResultCollector::Shards {
+ public:
+  explicit Shards(size_t capacity)
+      : capacity_(capacity),
+        mask_(shardCount() - 1),
+        shards_(new ResultShard[mask_ + 1]),
+        size_(0),
+        readerWaiting_(false),
+        writersWaiting_(0),
+        ended_(false),
+        generation_(0),
+        delivered_(false),
+        failed_(false),
+        closed_(false),
+        cursor_(0),
+        results_(CacheableVector::create()) {}
+
+  /**
+   * Releases producers still waiting for room, dropping their results.
+   */
+  ~Shards() {
+    std::unique_lock<decltype(mutex_)> lock(mutex_);
+    closed_ = true;
+    writable_.notify_all();
+    writable_.wait(lock, [this] { return writersWaiting_ == 0; });
+  }
+
+  /**
+   * Results added once the collector has failed or been destroyed are
+   * dropped, nobody is going to consume them.
+   */
+  void push(const std::shared_ptr<Cacheable>& result) {
+    if (failed_ || closed_) {
+      return;
+    }
+    if (capacity_ > 0 && size_.load(std::memory_order_relaxed) >= capacity_ &&
+        !waitWritable()) {
+      return;
+    }
+
+    shards_[threadShardIndex() & mask_].push(new ResultNode(
+        result, generation_.load(std::memory_order_relaxed)));
+
+    // pairs with waitReadable, either the reader sees the new size or this
+    // thread sees the reader waiting
+    size_.fetch_add(1);
+    if (readerWaiting_.load()) {
+      std::lock_guard<decltype(mutex_)> lock(mutex_);
+      readable_.notify_one();
+    }
+  }
+
+  void end() {
+    {
+      std::lock_guard<decltype(mutex_)> lock(mutex_);
+      ended_ = true;
+    }
+    readable_.notify_all();
+  }
+
+  bool next(std::shared_ptr<Cacheable>& result,
+            std::chrono::milliseconds timeout) {
+    std::lock_guard<decltype(readMutex_)> guard(readMutex_);
+    auto next = nextResult(result, std::chrono::steady_clock::now() + timeout);
+    if (next == FAILED) {
+      throwRetried();
+    } else if (next != TIMEOUT) {
+      return next == RESULT;
+    }
+
+    throw FunctionExecutionException(
+        "No function execution result received within timeout");
+  }
+
+  std::shared_ptr<CacheableVector> drain(std::chrono::milliseconds timeout) {
+    std::lock_guard<decltype(readMutex_)> guard(readMutex_);
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+    std::shared_ptr<Cacheable> result;
+    NextResult next;
+    while ((next = nextResult(result, deadline)) == RESULT) {
+      results_->push_back(std::move(result));
+    }
+    if (next == END) {
+      return results_;
+    } else if (next == FAILED) {
+      throwRetried();
+    }
+
+    throw FunctionExecutionException(
+        "Result is not ready, endResults callback is called before invoking "
+        "getResult() method");
+  }
+
+  /**
+   * Discards the results added so far. Once some have been handed out the
+   * collector fails instead, as a re-execution would hand them out again.
+   */
+  void clear() {
+    // pairs with nextResult, either the consumer sees the new generation or
+    // this thread sees a result delivered
+    generation_.fetch_add(1);
+    if (delivered_.load()) {
+      {
+        std::lock_guard<decltype(mutex_)> lock(mutex_);
+        failed_ = true;
+      }
+      readable_.notify_all();
+      writable_.notify_all();
+      throwRetried();
+    }
+
+    // a waiting consumer holds the lock, it discards the results itself
+    std::unique_lock<decltype(readMutex_)> guard(readMutex_, std::try_to_lock);
+    if (guard.owns_lock()) {
+      std::shared_ptr<Cacheable> result;
+      uint64_t generation;
+      while (take(result, generation)) {
+      }
+    }
+  }
+
+ private:
+  enum NextResult { RESULT, END, TIMEOUT, FAILED };
+
+  const size_t capacity_;
+  const size_t mask_;
+  std::unique_ptr<ResultShard[]> shards_;
+  std::atomic<size_t> size_;
+  std::atomic<bool> readerWaiting_;
+  std::atomic<size_t> writersWaiting_;
+  std::atomic<bool> ended_;
+  std::atomic<uint64_t> generation_;
+  std::atomic<bool> delivered_;
+  std::atomic<bool> failed_;
+  std::atomic<bool> closed_;
+  std::mutex mutex_;
+  std::condition_variable readable_;
+  std::condition_variable writable_;
+
+  // consumer side, guarded by readMutex_
+  std::mutex readMutex_;
+  size_t cursor_;
+  std::shared_ptr<CacheableVector> results_;
+
+  [[noreturn]] static void throwRetried() {
+    throw FunctionExecutionException(
+        "Function execution was retried after results had been consumed");
+  }
+
+  NextResult nextResult(std::shared_ptr<Cacheable>& result,
+                        std::chrono::steady_clock::time_point deadline) {
+    uint64_t generation;
+    while (true) {
+      if (failed_) {
+        return FAILED;
+      }
+
+      if (size_ > 0) {
+        if (take(result, generation)) {
+          if (generation != generation_.load(std::memory_order_relaxed)) {
+            continue;  // added before clearResults
+          }
+          delivered_.store(true);
+          if (generation != generation_.load()) {
+            continue;
+          }
+          return RESULT;
+        }
+        // added but not yet linked in by its producer
+        std::this_thread::yield();
+        continue;
+      }
+
+      if (ended_) {
+        // all producers are done once the execution has ended
+        if (size_ == 0) {
+          return END;
+        }
+        continue;
+      }
+
+      if (!waitReadable(deadline)) {
+        return TIMEOUT;
+      }
+    }
+  }
+
+  bool waitReadable(std::chrono::steady_clock::time_point deadline) {
+    std::unique_lock<decltype(mutex_)> lock(mutex_);
+    readerWaiting_ = true;
+    auto ready = readable_.wait_until(
+        lock, deadline, [this] { return size_ > 0 || ended_ || failed_; });
+    readerWaiting_ = false;
+    return ready;
+  }
+
+  /**
+   * Returns false if the result is to be dropped instead.
+   */
+  bool waitWritable() {
+    std::unique_lock<decltype(mutex_)> lock(mutex_);
+    ++writersWaiting_;
+    writable_.wait(lock,
+                   [this] { return size_ < capacity_ || failed_ || closed_; });
+    --writersWaiting_;
+    auto writable = !failed_ && !closed_;
+    if (closed_) {
+      // the destructor waits for the last writer to leave
+      writable_.notify_all();
+    }
+    return writable;
+  }
+
+  bool take(std::shared_ptr<Cacheable>& result, uint64_t& generation) {
+    for (size_t i = 0; i <= mask_; ++i) {
+      auto index = (cursor_ + i) & mask_;
+      if (shards_[index].pop(result, generation)) {
+        // rotate so that no single server starves the others
+        cursor_ = index + 1;
+
+        // pairs with waitWritable, either the writer sees the new size or
+        // this thread sees the writer waiting
+        auto size = size_.fetch_sub(1) - 1;
+        if (size < capacity_ && writersWaiting_ > 0) {
+          std::lock_guard<decltype(mutex_)> lock(mutex_);
+          writable_.notify_all();
+        }
+        return true;
+      }
+    }
+    return false;
+  }
+};
+
+StreamingResultCollector::StreamingResultCollector(size_t capacity)
+    : shards_(new Shards(capacity)) {}
+
+StreamingResultCollector::~StreamingResultCollector() noexcept = default;
+
+bool StreamingResultCollector::next(std::shared_ptr<Cacheable>& result,
+                                    std::chrono::milliseconds timeout) {
+  return shards_->next(result, timeout);
+}
+
+std::shared_ptr<CacheableVector> StreamingResultCollector::getResult(
+    std::chrono::milliseconds timeout) {
+  return shards_->drain(timeout);
+}
+
+void StreamingResultCollector::addResult(
+    const std::shared_ptr<Cacheable>& result) {
+  shards_->push(result);
+}
+
+void StreamingResultCollector::endResults() { shards_->end(); }
+
+void StreamingResultCollector::clearResults() { shards_->clear(); }
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
@@ -0,0 +1,283 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "SubscriptionReactor.hpp"
+
+#include <condition_variable>
+#include <cstring>
+#include <thread>
+
+#if defined(__linux__)
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#endif
+
+#include <geode/ExceptionTypes.hpp>
+
+#include "util/Log.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+const char* SubscriptionReactor::NC_Reactor = "NC Reactor";
+
+namespace {
+
+// identifies the wakeup event among the channels
+const uint64_t WAKEUP_ID = 0;
+
+const int MAX_EVENTS = 16;
+
+}  // namespace
+
+class SubscriptionReactor::Channel {
+ public:
+  Channel(uint64_t id, std::intptr_t handle, Receive receive,
+          HasBufferedData hasBufferedData)
+      : id(id),
+        handle(static_cast<int>(handle)),
+        receive(std::move(receive)),
+        hasBufferedData(std::move(hasBufferedData)),
+        running(false),
+        busy(false) {}
+
+  const uint64_t id;
+  const int handle;
+  const Receive receive;
+  const HasBufferedData hasBufferedData;
+
+  // running and busy change under mutex, running is also read without it
+  // by receive
+  std::mutex mutex;
+  std::condition_variable idle;
+  std::atomic<bool> running;
+  bool busy;
+  std::thread::id runner;
+};
+
+class SubscriptionReactor::Receiver : public NotificationReceiver {
+ public:
+  Receiver(SubscriptionReactor& reactor, std::shared_ptr<Channel> channel)
+      : reactor_(reactor), channel_(std::move(channel)) {}
+
+  ~Receiver() noexcept override {
+    stopNoblock();
+    wait();
+  }
+
+  void start() override { reactor_.add(channel_); }
+
+  void stopNoblock() noexcept override { reactor_.remove(*channel_); }
+
+  void wait() noexcept override {
+    std::unique_lock<std::mutex> lock(channel_->mutex);
+    // stopped while processing one of its own messages
+    if (channel_->runner == std::this_thread::get_id()) {
+      return;
+    }
+    channel_->idle.wait(lock, [this] { return !channel_->busy; });
+  }
+
+ private:
+  SubscriptionReactor& reactor_;
+  std::shared_ptr<Channel> channel_;
+};
+
+#if defined(__linux__)
+
+bool SubscriptionReactor::isSupported() { return true; }
+
+SubscriptionReactor::SubscriptionReactor(size_t threads)
+    : epoll_(::epoll_create1(EPOLL_CLOEXEC)),
+      wakeup_(-1),
+      nextId_(WAKEUP_ID) {
+  if (epoll_ == -1) {
+    throw GeodeIOException("SubscriptionReactor: epoll_create1 failed: " +
+                           std::string(std::strerror(errno)));
+  }
+
+  // level triggered and never read, so it wakes every thread once set
+  wakeup_ = ::eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+  epoll_event event{};
+  event.events = EPOLLIN;
+  event.data.u64 = WAKEUP_ID;
+  if (wakeup_ == -1 ||
+      ::epoll_ctl(epoll_, EPOLL_CTL_ADD, wakeup_, &event) == -1) {
+    auto error = std::string(std::strerror(errno));
+    if (wakeup_ != -1) {
+      ::close(wakeup_);
+    }
+    ::close(epoll_);
+    throw GeodeIOException("SubscriptionReactor: eventfd failed: " + error);
+  }
+
+  for (size_t i = 0; i < threads; ++i) {
+    threads_.emplace_back(new Task<SubscriptionReactor>(
+        this, &SubscriptionReactor::run, NC_Reactor));
+    threads_.back()->start();
+  }
+  LOGFINE("Started %zu subscription reactor threads", threads);
+}
+
+SubscriptionReactor::~SubscriptionReactor() noexcept {
+  for (auto& thread : threads_) {
+    thread->stopNoblock();
+  }
+  uint64_t one = 1;
+  if (::write(wakeup_, &one, sizeof(one)) != sizeof(one)) {
+    LOGERROR("SubscriptionReactor: failed to wake up threads: %s",
+             std::strerror(errno));
+  }
+  threads_.clear();
+
+  ::close(wakeup_);
+  ::close(epoll_);
+}
+
+void SubscriptionReactor::add(const std::shared_ptr<Channel>& channel) {
+  std::lock_guard<std::mutex> guard(mutex_);
+  channels_[channel->id] = channel;
+  channel->running = true;
+
+  epoll_event event{};
+  event.events = EPOLLIN | EPOLLONESHOT;
+  event.data.u64 = channel->id;
+  if (::epoll_ctl(epoll_, EPOLL_CTL_ADD, channel->handle, &event) == -1) {
+    channel->running = false;
+    channels_.erase(channel->id);
+    throw GeodeIOException(
+        "SubscriptionReactor: failed to watch subscription channel: " +
+        std::string(std::strerror(errno)));
+  }
+}
+
+void SubscriptionReactor::remove(Channel& channel) {
+  {
+    std::lock_guard<std::mutex> guard(channel.mutex);
+    if (!channel.running) {
+      return;
+    }
+    channel.running = false;
+  }
+
+  std::lock_guard<std::mutex> guard(mutex_);
+  channels_.erase(channel.id);
+  // the socket is still open, so its handle can not yet have been reused
+  ::epoll_ctl(epoll_, EPOLL_CTL_DEL, channel.handle, nullptr);
+}
+
+void SubscriptionReactor::dispatch(uint64_t id) {
+  std::shared_ptr<Channel> channel;
+  {
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto found = channels_.find(id);
+    if (found == channels_.end()) {
+      return;
+    }
+    channel = found->second;
+  }
+
+  {
+    std::lock_guard<std::mutex> guard(channel->mutex);
+    if (!channel->running) {
+      return;
+    }
+    channel->busy = true;
+    channel->runner = std::this_thread::get_id();
+  }
+
+  bool receiving;
+  do {
+    receiving = channel->receive(channel->running);
+  } while (receiving && channel->running && channel->hasBufferedData());
+
+  std::lock_guard<std::mutex> guard(channel->mutex);
+  channel->busy = false;
+  channel->runner = std::thread::id();
+  if (receiving && channel->running) {
+    epoll_event event{};
+    event.events = EPOLLIN | EPOLLONESHOT;
+    event.data.u64 = channel->id;
+    if (::epoll_ctl(epoll_, EPOLL_CTL_MOD, channel->handle, &event) == -1) {
+      LOGERROR("SubscriptionReactor: failed to watch subscription channel: %s",
+               std::strerror(errno));
+    }
+  }
+  channel->idle.notify_all();
+}
+
+void SubscriptionReactor::run(std::atomic<bool>& isRunning) {
+  epoll_event events[MAX_EVENTS];
+  while (isRunning) {
+    auto count = ::epoll_wait(epoll_, events, MAX_EVENTS, -1);
+    if (count == -1) {
+      if (errno == EINTR) {
+        continue;
+      }
+      LOGERROR("SubscriptionReactor: epoll_wait failed: %s",
+               std::strerror(errno));
+      break;
+    }
+
+    for (int i = 0; i < count && isRunning; ++i) {
+      if (events[i].data.u64 != WAKEUP_ID) {
+        dispatch(events[i].data.u64);
+      }
+    }
+  }
+}
+
+#else
+
+bool SubscriptionReactor::isSupported() { return false; }
+
+SubscriptionReactor::SubscriptionReactor(size_t)
+    : epoll_(-1), wakeup_(-1), nextId_(WAKEUP_ID) {
+  throw UnsupportedOperationException(
+      "SubscriptionReactor is not supported on this platform");
+}
+
+SubscriptionReactor::~SubscriptionReactor() noexcept {}
+
+void SubscriptionReactor::add(const std::shared_ptr<Channel>&) {}
+
+void SubscriptionReactor::remove(Channel&) {}
+
+void SubscriptionReactor::dispatch(uint64_t) {}
+
+void SubscriptionReactor::run(std::atomic<bool>&) {}
+
+#endif
+
+std::unique_ptr<NotificationReceiver> SubscriptionReactor::createReceiver(
+    std::intptr_t handle, Receive receive, HasBufferedData hasBufferedData) {
+  uint64_t id;
+  {
+    std::lock_guard<std::mutex> guard(mutex_);
+    id = ++nextId_;
+  }
+  return std::unique_ptr<NotificationReceiver>(new Receiver(
+      *this,
+      std::make_shared<Channel>(id, handle, std::move(receive),
+                                std::move(hasBufferedData))));
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
@@ -0,0 +1,101 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_SUBSCRIPTIONREACTOR_H_
+#define GEODE_SUBSCRIPTIONREACTOR_H_
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "NotificationReceiver.hpp"
+#include "Task.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * Receives the messages of many subscription channels on a few threads,
+ * so the number of threads does not grow with the number of servers.
+ *
+ * The threads wait for any of the channels' sockets to become readable.
+ * The thread that is woken receives and processes the messages of that
+ * channel, then watches the channel again. A channel is served by at most
+ * one thread at a time, which keeps its messages in order.
+ *
+ * Only available where epoll is.
+ */
+class SubscriptionReactor {
+ public:
+  /**
+   * Receives and processes one message, returning false if the channel
+   * should be watched no more.
+   */
+  typedef std::function<bool(std::atomic<bool>& isRunning)> Receive;
+
+  /**
+   * Returns true if messages were received ahead, where the readiness of
+   * the socket does not show them.
+   */
+  typedef std::function<bool()> HasBufferedData;
+
+  static bool isSupported();
+
+  explicit SubscriptionReactor(size_t threads);
+  ~SubscriptionReactor() noexcept;
+
+  SubscriptionReactor(const SubscriptionReactor&) = delete;
+  SubscriptionReactor& operator=(const SubscriptionReactor&) = delete;
+
+  /**
+   * Returns a receiver that, once started, watches <code>handle</code> and
+   * calls <code>receive</code> whenever it is readable.
+   */
+  std::unique_ptr<NotificationReceiver> createReceiver(
+      std::intptr_t handle, Receive receive, HasBufferedData hasBufferedData);
+
+ private:
+  class Channel;
+  class Receiver;
+
+  int epoll_;
+  int wakeup_;
+  std::mutex mutex_;
+  uint64_t nextId_;
+  std::unordered_map<uint64_t, std::shared_ptr<Channel>> channels_;
+  std::vector<std::unique_ptr<Task<SubscriptionReactor>>> threads_;
+
+  void add(const std::shared_ptr<Channel>& channel);
+  void remove(Channel& channel);
+  void dispatch(uint64_t id);
+  void run(std::atomic<bool>& isRunning);
+
+  static const char* NC_Reactor;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_SUBSCRIPTIONREACTOR_H_
@@ -53,6 +53,7 @@ const char StatsDiskSpaceLimit[] = "archive-disk-space-limit";
 const char HeapLRULimit[] = "heap-lru-limit";
 const char HeapLRUDelta[] = "heap-lru-delta";
 const char MaxSocketBufferSize[] = "max-socket-buffer-size";
+const char IoUringEnabled[] = "io-uring-enabled";
 const char PingInterval[] = "ping-interval";
 const char RedundancyMonitorInterval[] = "redundancy-monitor-interval";
 const char DisableShufflingEndpoint[] = "disable-shuffling-of-endpoints";
@@ -69,10 +70,16 @@ const char SecurityClientKsPath[] = "security-client-kspath";
 const char AutoReadyForEvents[] = "auto-ready-for-events";
 const char SslEnabled[] = "ssl-enabled";
 const char TimeStatisticsEnabled[] = "enable-time-statistics";
+const char CoarseTimeStatistics[] = "coarse-time-statistics";
 const char SslKeyStore[] = "ssl-keystore";
 const char SslTrustStore[] = "ssl-truststore";
 const char SslKeystorePassword[] = "ssl-keystore-password";
 const char ThreadPoolSize[] = "max-fe-threads";
+const char SubscriptionReactorThreads[] = "subscription-reactor-threads";
+const char BulkOpBatchSize[] = "bulk-op-batch-size";
+const char BulkOpBatchesInFlight[] = "bulk-op-batches-in-flight";
+const char CacheLoaderCoalescingEnabled[] = "cache-loader-coalescing-enabled";
+const char PdxInstanceDeltaEnabled[] = "pdx-instance-delta-enabled";
 const char SuspendedTxTimeout[] = "suspended-tx-timeout";
 const char EnableChunkHandlerThread[] = "enable-chunk-handler-thread";
 const char OnClientDisconnectClearPdxTypeIds[] =
@@ -101,6 +108,7 @@ const int DefaultConnectionPoolSize = 5;
 const bool DefaultAutoReadyForEvents = true;
 const bool DefaultSslEnabled = false;
 const bool DefaultTimeStatisticsEnabled = false;  // or true;
+const bool DefaultCoarseTimeStatistics = false;
 
 const char DefaultSslKeyStore[] = "";
 const char DefaultSslTrustStore[] = "";
@@ -116,12 +124,21 @@ const size_t DefaultHeapLRULimit = 0;    // = unlimited, disabled when it is 0
 const int32_t DefaultHeapLRUDelta = 10;  // = unlimited, disabled when it is 0
 
 const int32_t DefaultMaxSocketBufferSize = 65 * 1024;
+const bool DefaultIoUringEnabled = false;
 constexpr auto DefaultPingInterval = std::chrono::seconds(10);
 constexpr auto DefaultRedundancyMonitorInterval = std::chrono::seconds(10);
 constexpr auto DefaultNotifyAckInterval = std::chrono::seconds(1);
 constexpr auto DefaultNotifyDupCheckLife = std::chrono::seconds(300);
 const char DefaultSecurityPrefix[] = "security-";
 const uint32_t DefaultThreadPoolSize = std::thread::hardware_concurrency() * 2;
+// every subscription channel has a thread of its own
+const uint32_t DefaultSubscriptionReactorThreads = 0;
+// bulk operations are sent as a single request
+const uint32_t DefaultBulkOpBatchSize = 0;
+const uint32_t DefaultBulkOpBatchesInFlight = 4;
+const bool DefaultCacheLoaderCoalescingEnabled = false;
+// servers without PdxInstance delta support reject every such put
+const bool DefaultPdxInstanceDeltaEnabled = false;
 constexpr auto DefaultSuspendedTxTimeout = std::chrono::seconds(30);
 constexpr auto DefaultTombstoneTimeout = std::chrono::seconds(480);
 // not disable; all region api will use chunk handler thread
@@ -160,6 +177,7 @@ SystemProperties::SystemProperties(
       m_heapLRULimit(DefaultHeapLRULimit),
       m_heapLRUDelta(DefaultHeapLRUDelta),
       m_maxSocketBufferSize(DefaultMaxSocketBufferSize),
+      m_ioUringEnabled(DefaultIoUringEnabled),
       m_pingInterval(DefaultPingInterval),
       m_redundancyMonitorInterval(DefaultRedundancyMonitorInterval),
       m_notifyAckInterval(DefaultNotifyAckInterval),
@@ -174,11 +192,17 @@ SystemProperties::SystemProperties(
       m_autoReadyForEvents(DefaultAutoReadyForEvents),
       m_sslEnabled(DefaultSslEnabled),
       m_timestatisticsEnabled(DefaultTimeStatisticsEnabled),
+      m_coarseTimeStatistics(DefaultCoarseTimeStatistics),
       m_sslKeyStore(DefaultSslKeyStore),
       m_sslTrustStore(DefaultSslTrustStore),
       m_sslKeystorePassword(DefaultSslKeystorePassword),
       m_conflateEvents(DefaultConflateEvents),
       m_threadPoolSize(DefaultThreadPoolSize),
+      m_subscriptionReactorThreads(DefaultSubscriptionReactorThreads),
+      m_bulkOpBatchSize(DefaultBulkOpBatchSize),
+      m_bulkOpBatchesInFlight(DefaultBulkOpBatchesInFlight),
+      m_cacheLoaderCoalescingEnabled(DefaultCacheLoaderCoalescingEnabled),
+      m_pdxInstanceDeltaEnabled(DefaultPdxInstanceDeltaEnabled),
       m_suspendedTxTimeout(DefaultSuspendedTxTimeout),
       m_tombstoneTimeout(DefaultTombstoneTimeout),
       m_enableChunkHandlerThread(DefaultEnableChunkHandlerThread),
@@ -279,8 +303,20 @@ void SystemProperties::processProperty(const std::string& property,
 
   if (property == ThreadPoolSize) {
     m_threadPoolSize = std::stoul(value);
+  } else if (property == SubscriptionReactorThreads) {
+    m_subscriptionReactorThreads = std::stoul(value);
+  } else if (property == BulkOpBatchSize) {
+    m_bulkOpBatchSize = std::stoul(value);
+  } else if (property == BulkOpBatchesInFlight) {
+    m_bulkOpBatchesInFlight = std::stoul(value);
+  } else if (property == CacheLoaderCoalescingEnabled) {
+    m_cacheLoaderCoalescingEnabled = parseBooleanProperty(property, value);
+  } else if (property == PdxInstanceDeltaEnabled) {
+    m_pdxInstanceDeltaEnabled = parseBooleanProperty(property, value);
   } else if (property == MaxSocketBufferSize) {
     m_maxSocketBufferSize = std::stol(value);
+  } else if (property == IoUringEnabled) {
+    m_ioUringEnabled = parseBooleanProperty(property, value);
   } else if (property == PingInterval) {
     parseDurationProperty(property, std::string(value), m_pingInterval);
   } else if (property == RedundancyMonitorInterval) {
@@ -309,6 +345,8 @@ void SystemProperties::processProperty(const std::string& property,
     m_sslEnabled = parseBooleanProperty(property, value);
   } else if (property == TimeStatisticsEnabled) {
     m_timestatisticsEnabled = parseBooleanProperty(property, value);
+  } else if (property == CoarseTimeStatistics) {
+    m_coarseTimeStatistics = parseBooleanProperty(property, value);
   } else if (property == StatisticsEnabled) {
     m_statisticsEnabled = parseBooleanProperty(property, value);
   } else if (property == StatisticsArchiveFile) {
@@ -382,9 +420,21 @@ void SystemProperties::logSettings() {
   settings += "\n  bucket-wait-timeout = ";
   settings += to_string(bucketWaitTimeout());
 
+  settings += "\n  bulk-op-batch-size = ";
+  settings += std::to_string(bulkOpBatchSize());
+
+  settings += "\n  bulk-op-batches-in-flight = ";
+  settings += std::to_string(bulkOpBatchesInFlight());
+
+  settings += "\n  cache-loader-coalescing-enabled = ";
+  settings += cacheLoaderCoalescingEnabled() ? "true" : "false";
+
   settings += "\n  cache-xml-file = ";
   settings += cacheXMLFile();
 
+  settings += "\n  coarse-time-statistics = ";
+  settings += getCoarseTimeStatistics() ? "true" : "false";
+
   settings += "\n  conflate-events = ";
   settings += conflateEvents();
 
@@ -420,6 +470,9 @@ void SystemProperties::logSettings() {
   settings += "\n  heap-lru-limit = ";
   settings += std::to_string(heapLRULimit());
 
+  settings += "\n  io-uring-enabled = ";
+  settings += ioUringEnabled() ? "true" : "false";
+
   settings += "\n  log-disk-space-limit = ";
   settings += std::to_string(logDiskSpaceLimit());
 
@@ -447,6 +500,9 @@ void SystemProperties::logSettings() {
   settings += "\n  on-client-disconnect-clear-pdxType-Ids = ";
   settings += onClientDisconnectClearPdxTypeIds() ? "true" : "false";
 
+  settings += "\n  pdx-instance-delta-enabled = ";
+  settings += pdxInstanceDeltaEnabled() ? "true" : "false";
+
   // *** PLEASE ADD IN ALPHABETICAL ORDER - USER VISIBLE ***
 
   settings += "\n  ping-interval = ";
@@ -476,6 +532,9 @@ void SystemProperties::logSettings() {
   settings += "\n  statistic-sample-rate = ";
   settings += to_string(statisticsSampleInterval());
 
+  settings += "\n  subscription-reactor-threads = ";
+  settings += std::to_string(subscriptionReactorThreads());
+
   settings += "\n  suspended-tx-timeout = ";
   settings += to_string(suspendedTxTimeout());
 
@@ -17,14 +17,19 @@
 
 #include "TcpConn.hpp"
 
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
 #include <thread>
 
+#include <ace/ACE.h>
 #include <ace/SOCK_Connector.h>
 #include <boost/interprocess/mapped_region.hpp>
 
 #include <geode/ExceptionTypes.hpp>
 #include <geode/internal/chrono/duration.hpp>
 
+#include "IoUring.hpp"
 #include "util/Log.hpp"
 
 namespace apache {
@@ -32,6 +37,7 @@ namespace geode {
 namespace client {
 
 const size_t TcpConn::kChunkSize = TcpConn::getDefaultChunkSize();
+const size_t TcpConn::kReadBufferSize = 16 * 1024;
 
 void TcpConn::clearNagle(ACE_HANDLE sock) {
   int32_t val = 1;
@@ -128,6 +134,9 @@ TcpConn::TcpConn(const std::string& address,
                  std::chrono::microseconds waitSeconds, int32_t maxBuffSizePool)
     : stream_(nullptr),
       maxBuffSizePool_(maxBuffSizePool),
+      readBegin_(0),
+      readEnd_(0),
+      ioUring_(false),
       inetAddress_(address.c_str()),
       endpoint_(address),
       timeout_(waitSeconds) {}
@@ -136,6 +145,9 @@ TcpConn::TcpConn(const std::string& hostname, uint16_t port,
                  std::chrono::microseconds waitSeconds, int32_t maxBuffSizePool)
     : stream_(nullptr),
       maxBuffSizePool_(maxBuffSizePool),
+      readBegin_(0),
+      readEnd_(0),
+      ioUring_(false),
       inetAddress_(port, hostname.c_str()),
       endpoint_(hostname + ":" + std::to_string(port)),
       timeout_(waitSeconds) {}
@@ -163,28 +175,173 @@ void TcpConn::connect() {
                            ACE_errno_to_string(lastError));
   }
 
-  if (stream_->enable(ACE_NONBLOCK)) {
+  if (ioUring_) {
+    if (stream_->disable(ACE_NONBLOCK)) {
+      LOGINFO("TcpConn::BLOCK: " + ACE_errno_to_string(ACE_OS::last_error()));
+    }
+  } else if (stream_->enable(ACE_NONBLOCK)) {
     LOGINFO("TcpConn::NONBLOCK: " + ACE_errno_to_string(ACE_OS::last_error()));
   }
 }
 
+void TcpConn::enableIoUring() { ioUring_ = IoUring::isSupported(); }
+
 void TcpConn::close() {
   if (stream_) {
     stream_->close();
     stream_ = nullptr;
   }
+  readBegin_ = readEnd_ = 0;
 }
 
 size_t TcpConn::receive(char* buff, size_t len,
                         std::chrono::microseconds waitSeconds) {
-  return socketOp(SOCK_READ, buff, len, waitSeconds);
+  if (!readBuffer_) {
+    readBuffer_ = std::unique_ptr<char[]>(new char[kReadBufferSize]);
+  }
+
+  const auto deadline = std::chrono::steady_clock::now() + waitSeconds;
+  size_t received = 0;
+  while (true) {
+    const auto buffered = std::min(len - received, readEnd_ - readBegin_);
+    std::memcpy(buff + received, readBuffer_.get() + readBegin_, buffered);
+    readBegin_ += buffered;
+    received += buffered;
+    if (received == len) {
+      break;
+    }
+
+    // large remainders go straight to the caller, small ones are read
+    // together with whatever follows them
+    const auto remaining = len - received;
+    const auto direct = remaining >= kReadBufferSize;
+    const auto retVal =
+        direct ? receiveAvailable(buff + received, remaining, deadline)
+               : receiveAvailable(readBuffer_.get(), kReadBufferSize, deadline);
+    if (retVal < 0) {
+      break;
+    } else if (retVal == 0) {
+      ACE_OS::last_error(EPIPE);
+      break;
+    } else if (direct) {
+      received += static_cast<size_t>(retVal);
+    } else {
+      readBegin_ = 0;
+      readEnd_ = static_cast<size_t>(retVal);
+    }
+  }
+
+  return received;
+}
+
+ssize_t TcpConn::receiveAvailable(
+    char* buff, size_t len, std::chrono::steady_clock::time_point deadline) {
+  if (ioUring_) {
+    return receiveIoUring(buff, len, deadline);
+  }
+
+  // the socket is non-blocking, so wait for it only if it has nothing
+  while (true) {
+    const auto retVal = stream_->recv(buff, len);
+    if (retVal >= 0) {
+      return retVal;
+    }
+    const auto lastError = ACE_OS::last_error();
+    if (lastError != EWOULDBLOCK && lastError != EAGAIN &&
+        lastError != EINTR) {
+      return -1;
+    }
+
+    if (lastError != EINTR) {
+      const auto waitDuration =
+          std::chrono::duration_cast<std::chrono::microseconds>(
+              deadline - std::chrono::steady_clock::now());
+      if (waitDuration <= std::chrono::microseconds::zero()) {
+        ACE_OS::last_error(ETIME);
+        return -1;
+      }
+      ACE_Time_Value waitTime(waitDuration);
+      if (ACE::handle_read_ready(stream_->get_handle(), &waitTime) == -1 &&
+          ACE_OS::last_error() != EINTR) {
+        return -1;
+      }
+    }
+  }
+}
+
+ssize_t TcpConn::receiveIoUring(
+    char* buff, size_t len, std::chrono::steady_clock::time_point deadline) {
+  while (true) {
+    const auto waitDuration =
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            deadline - std::chrono::steady_clock::now());
+    if (waitDuration <= std::chrono::microseconds::zero()) {
+      ACE_OS::last_error(ETIME);
+      return -1;
+    }
+
+    auto ioUring = IoUring::forThread();
+    if (!ioUring) {
+      // no ring for this thread, wait on the blocking socket instead
+      ACE_Time_Value waitTime(waitDuration);
+      return stream_->recv(buff, len, &waitTime);
+    }
+
+    const auto retVal =
+        ioUring->receive(stream_->get_handle(), buff, len, waitDuration);
+    if (retVal >= 0) {
+      return static_cast<ssize_t>(retVal);
+    }
+    const auto lastError = errno;
+    if (lastError != EINTR) {
+      ACE_OS::last_error(lastError);
+      return -1;
+    }
+  }
 }
 
 size_t TcpConn::send(const char* buff, size_t len,
                      std::chrono::microseconds waitSeconds) {
+  if (ioUring_) {
+    return sendIoUring(buff, len, waitSeconds);
+  }
   return socketOp(SOCK_WRITE, const_cast<char*>(buff), len, waitSeconds);
 }
 
+size_t TcpConn::sendIoUring(const char* buff, size_t len,
+                            std::chrono::microseconds waitSeconds) {
+  auto ioUring = IoUring::forThread();
+  if (!ioUring) {
+    return socketOp(SOCK_WRITE, const_cast<char*>(buff), len, waitSeconds);
+  }
+
+  const auto deadline = std::chrono::steady_clock::now() + waitSeconds;
+  size_t sent = 0;
+  while (sent < len) {
+    const auto waitDuration =
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            deadline - std::chrono::steady_clock::now());
+    if (waitDuration <= std::chrono::microseconds::zero()) {
+      ACE_OS::last_error(ETIME);
+      break;
+    }
+
+    const auto retVal = ioUring->send(stream_->get_handle(), buff + sent,
+                                      len - sent, waitDuration);
+    if (retVal > 0) {
+      sent += static_cast<size_t>(retVal);
+    } else if (retVal == 0) {
+      ACE_OS::last_error(EPIPE);
+      break;
+    } else if (errno != EINTR) {
+      ACE_OS::last_error(errno);
+      break;
+    }
+  }
+
+  return sent;
+}
+
 size_t TcpConn::socketOp(TcpConn::SockOp op, char* buff, size_t len,
                          std::chrono::microseconds waitDuration) {
   {
@@ -254,6 +411,10 @@ uint16_t TcpConn::getPort() {
   return localAddr.get_port_number();
 }
 
+std::intptr_t TcpConn::getReadHandle() const {
+  return stream_ ? static_cast<std::intptr_t>(stream_->get_handle()) : -1;
+}
+
 size_t TcpConn::getDefaultChunkSize() {
   //
   auto pageSize = boost::interprocess::mapped_region::get_page_size();
@@ -42,16 +42,38 @@ class TcpConn : public Connector {
   std::unique_ptr<ACE_SOCK_Stream> stream_;
   const int32_t maxBuffSizePool_;
 
+  /**
+   * Bytes received ahead of the reader, e.g. the body of a message whose
+   * header was asked for. Allocated on the first receive.
+   */
+  std::unique_ptr<char[]> readBuffer_;
+  size_t readBegin_;
+  size_t readEnd_;
+
+  /**
+   * Transfers go through the calling thread's IoUring. The socket is then
+   * left blocking, as io_uring would fail transfers on a non-blocking socket
+   * instead of waiting for it.
+   */
+  bool ioUring_;
+
   /**
    * Attempt to set chunk size to nearest OS page size for perf improvement
    */
   static size_t getDefaultChunkSize();
 
+  ssize_t receiveIoUring(char* buff, size_t len,
+                         std::chrono::steady_clock::time_point deadline);
+
+  size_t sendIoUring(const char* buff, size_t len,
+                     std::chrono::microseconds waitSeconds);
+
  protected:
   ACE_INET_Addr inetAddress_;
   std::string endpoint_;
   std::chrono::microseconds timeout_;
   static const size_t kChunkSize;
+  static const size_t kReadBufferSize;
 
   enum SockOp { SOCK_READ, SOCK_WRITE };
 
@@ -63,6 +85,15 @@ class TcpConn : public Connector {
 
   virtual void createSocket(ACE_HANDLE sock);
 
+  /**
+   * Reads whatever is available, up to <code>len</code> bytes, waiting
+   * until <code>deadline</code> only if nothing is. Returns the number of
+   * bytes read, 0 if the peer closed the connection, or -1 with the error
+   * set, ETIME if the deadline passed.
+   */
+  virtual ssize_t receiveAvailable(
+      char* buff, size_t len, std::chrono::steady_clock::time_point deadline);
+
   virtual ssize_t doOperation(const SockOp& op, void* buff, size_t sendlen,
                               ACE_Time_Value& waitTime, size_t& readLen) const;
 
@@ -75,6 +106,12 @@ class TcpConn : public Connector {
 
   ~TcpConn() override {}
 
+  /**
+   * Sends and receives through io_uring if it is available. Must be called
+   * before init.
+   */
+  void enableIoUring();
+
   void close() override;
 
   void init() override;
@@ -88,6 +125,10 @@ class TcpConn : public Connector {
               std::chrono::microseconds waitSeconds) override;
 
   virtual uint16_t getPort() override;
+
+  std::intptr_t getReadHandle() const override;
+
+  bool hasBufferedData() const override { return readBegin_ < readEnd_; }
 };
 
 }  // namespace client
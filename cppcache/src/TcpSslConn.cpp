@@ -74,6 +74,7 @@ void TcpSslConn::close() {
     stream_->close();
     stream_ = nullptr;
   }
+  TcpConn::close();
 }
 
 uint16_t TcpSslConn::getPort() {
@@ -130,6 +131,21 @@ ssize_t TcpSslConn::doOperation(const TcpConn::SockOp& op, void* buff,
   }
 }
 
+ssize_t TcpSslConn::receiveAvailable(
+    char* buff, size_t len, std::chrono::steady_clock::time_point deadline) {
+  const auto waitDuration =
+      std::chrono::duration_cast<std::chrono::microseconds>(
+          deadline - std::chrono::steady_clock::now());
+  if (waitDuration <= std::chrono::microseconds::zero()) {
+    ACE_OS::last_error(ETIME);
+    return -1;
+  }
+
+  // also returns records already decrypted by the SSL layer without waiting
+  ACE_Time_Value waitTime(waitDuration);
+  return stream_->recv(buff, len, &waitTime);
+}
+
 }  // namespace client
 }  // namespace geode
 }  // namespace apache
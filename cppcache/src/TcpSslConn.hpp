@@ -59,6 +59,10 @@ class TcpSslConn : public TcpConn {
   ssize_t doOperation(const SockOp& op, void* buff, size_t sendlen,
                       ACE_Time_Value& waitTime, size_t& readLen) const override;
 
+  ssize_t receiveAvailable(
+      char* buff, size_t len,
+      std::chrono::steady_clock::time_point deadline) override;
+
   void initSsl();
 
  public:
@@ -102,6 +106,9 @@ class TcpSslConn : public TcpConn {
   void connect() override;
 
   uint16_t getPort() override;
+
+  // decrypted data may be pending in the SSL layer
+  std::intptr_t getReadHandle() const override { return -1; }
 };
 }  // namespace client
 }  // namespace geode
@@ -68,6 +68,13 @@ class TcrChunkedResult {
    */
   virtual void reset() = 0;
 
+  /**
+   * Whether chunks must be handled on the thread reading the reply rather
+   * than on the chunk processor thread shared by all requests of the pool,
+   * e.g. because handling a chunk may wait for a consumer.
+   */
+  virtual bool handleChunksInReader() const { return false; }
+
   void fireHandleChunk(const uint8_t* bytes, int32_t len,
                        uint8_t isLastChunkWithSecurity,
                        const CacheImpl* cacheImpl) {
@@ -144,6 +151,10 @@ class TcrChunkedContext {
 
   inline size_t getLen() const { return m_chunk.size(); }
 
+  inline bool handleInReader() const {
+    return m_result->handleChunksInReader();
+  }
+
   void handleChunk(bool inSameThread) {
     if (m_chunk.empty()) {
       // this is the last chunk for some set of chunks
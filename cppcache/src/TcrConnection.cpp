@@ -446,7 +446,11 @@ Connector* TcrConnection::createConnection(
           systemProperties.sslKeystorePassword());
     }
   } else {
-    socket = new TcpConn(address, connectTimeout, maxBuffSizePool);
+    auto tcpConn = new TcpConn(address, connectTimeout, maxBuffSizePool);
+    if (systemProperties.ioUringEnabled()) {
+      tcpConn->enableIoUring();
+    }
+    socket = tcpConn;
   }
   // as socket.init() calls throws exception...
   m_conn = socket;
@@ -290,6 +290,18 @@ class TcrConnection {
 
   uint16_t inline getPort() { return m_port; }
 
+  /**
+   * Returns the socket to watch for messages, see Connector::getReadHandle.
+   */
+  std::intptr_t getReadHandle() const {
+    return m_conn ? m_conn->getReadHandle() : -1;
+  }
+
+  /**
+   * Returns true if (part of) a message has already been received.
+   */
+  bool hasBufferedData() const { return m_conn && m_conn->hasBufferedData(); }
+
   TcrEndpoint* getEndpointObject() const { return m_endpointObj; }
   bool isBeingUsed() { return m_isBeingUsed; }
   bool setAndGetBeingUsed(
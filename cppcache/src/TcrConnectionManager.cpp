@@ -95,6 +95,17 @@ void TcrConnectionManager::init(bool isPool) {
 
   m_redundancyManager->m_HAenabled = false;
 
+  if (auto reactorThreads = props.subscriptionReactorThreads()) {
+    if (SubscriptionReactor::isSupported()) {
+      m_subscriptionReactor = std::unique_ptr<SubscriptionReactor>(
+          new SubscriptionReactor(reactorThreads));
+    } else {
+      LOGWARN(
+          "subscription-reactor-threads is not supported on this platform, "
+          "every subscription channel receives on a thread of its own");
+    }
+  }
+
   startFailoverAndCleanupThreads(isPool);
 }
 
@@ -443,7 +454,7 @@ void TcrConnectionManager::redundancy(std::atomic<bool> &isRunning) {
 }
 
 void TcrConnectionManager::addNotificationForDeletion(
-    Task<TcrEndpoint> *notifyReceiver, TcrConnection *notifyConnection,
+    NotificationReceiver *notifyReceiver, TcrConnection *notifyConnection,
     ACE_Semaphore &notifyCleanupSema) {
   std::lock_guard<decltype(m_notificationLock)> guard(m_notificationLock);
   m_connectionReleaseList.put(notifyConnection);
@@ -475,7 +486,7 @@ void TcrConnectionManager::cleanup(std::atomic<bool> &isRunning) {
 }
 
 void TcrConnectionManager::cleanNotificationLists() {
-  Task<TcrEndpoint> *notifyReceiver;
+  NotificationReceiver *notifyReceiver;
   TcrConnection *notifyConnection;
   ACE_Semaphore *notifyCleanupSema;
 
@@ -29,7 +29,9 @@
 #include <geode/internal/geode_globals.hpp>
 
 #include "ExpiryTaskManager.hpp"
+#include "NotificationReceiver.hpp"
 #include "Queue.hpp"
+#include "SubscriptionReactor.hpp"
 #include "Task.hpp"
 #include "ThinClientRedundancyManager.hpp"
 #include "util/synchronized_map.hpp"
@@ -88,12 +90,20 @@ class TcrConnectionManager {
                                        TcrMessageReply* reply);
   GfErrType sendSyncRequestCq(TcrMessage& request, TcrMessageReply& reply);
 
-  void addNotificationForDeletion(Task<TcrEndpoint>* notifyReceiver,
+  void addNotificationForDeletion(NotificationReceiver* notifyReceiver,
                                   TcrConnection* notifyConnection,
                                   ACE_Semaphore& notifyCleanupSema);
 
   void processMarker();
 
+  /**
+   * Returns the reactor receiving the subscription channels' messages, or
+   * nullptr if every channel receives on a thread of its own.
+   */
+  SubscriptionReactor* getSubscriptionReactor() const {
+    return m_subscriptionReactor.get();
+  }
+
   bool getEndpointStatus(const std::string& endpoint);
 
   void addPoolEndpoints(TcrEndpoint* endpoint) {
@@ -140,6 +150,8 @@ class TcrConnectionManager {
 
  private:
   CacheImpl* m_cache;
+  // destroyed last, after all endpoints and their subscription channels
+  std::unique_ptr<SubscriptionReactor> m_subscriptionReactor;
   volatile bool m_initGuard;
   synchronized_map<std::unordered_map<std::string, TcrEndpoint*>,
                    std::recursive_mutex>
@@ -165,7 +177,7 @@ class TcrConnectionManager {
 
   ExpiryTaskManager::id_type m_pingTaskId;
   ExpiryTaskManager::id_type m_servermonitorTaskId;
-  Queue<Task<TcrEndpoint>*> m_receiverReleaseList;
+  Queue<NotificationReceiver*> m_receiverReleaseList;
   Queue<TcrConnection*> m_connectionReleaseList;
   Queue<ACE_Semaphore*> m_notifyCleanupSemaList;
 
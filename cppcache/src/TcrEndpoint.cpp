@@ -456,10 +456,7 @@ GfErrType TcrEndpoint::registerDM(bool clientNotification, bool isSecondary,
                   m_name.c_str());
           return err;
         }
-        m_notifyReceiver =
-            std::unique_ptr<Task<TcrEndpoint>>(new Task<TcrEndpoint>(
-                this, &TcrEndpoint::receiveNotification, NC_Notification));
-        m_notifyReceiver->start();
+        startNotificationReceiver();
       }
       ++m_numRegionListener;
       LOGFINEST("Incremented notification region count for endpoint %s to %d",
@@ -475,6 +472,25 @@ GfErrType TcrEndpoint::registerDM(bool clientNotification, bool isSecondary,
   return err;
 }
 
+void TcrEndpoint::startNotificationReceiver() {
+  auto reactor = m_cacheImpl->tcrConnectionManager().getSubscriptionReactor();
+  auto handle = m_notifyConnection->getReadHandle();
+  if (reactor != nullptr && handle != -1) {
+    auto connection = m_notifyConnection;
+    m_notifyReceiver = reactor->createReceiver(
+        handle,
+        [this](std::atomic<bool>& isRunning) {
+          return processNotification(isRunning);
+        },
+        [connection]() { return connection->hasBufferedData(); });
+  } else {
+    m_notifyReceiver = std::unique_ptr<NotificationReceiver>(
+        new TaskNotificationReceiver<TcrEndpoint>(
+            this, &TcrEndpoint::receiveNotification, NC_Notification));
+  }
+  m_notifyReceiver->start();
+}
+
 void TcrEndpoint::unregisterDM(bool clientNotification,
                                ThinClientBaseDM* distMgr, bool) {
   if (clientNotification) {
@@ -549,156 +565,158 @@ bool TcrEndpoint::checkDupAndAdd(std::shared_ptr<EventId> eventid) {
 
 void TcrEndpoint::receiveNotification(std::atomic<bool>& isRunning) {
   LOGFINE("Started subscription channel for endpoint %s", m_name.c_str());
-  while (isRunning) {
-    TcrMessageReply* msg = nullptr;
-    try {
-      size_t dataLen;
-      ConnErrType opErr = CONN_NOERR;
-      auto data = m_notifyConnection->receive(&dataLen, &opErr,
-                                              std::chrono::seconds(5));
-
-      if (opErr == CONN_IOERR) {
-        // Endpoint is disconnected, this exception is expected
-        LOGFINER(
-            "IO exception while receiving subscription event for endpoint %d",
-            opErr);
-        if (isRunning) {
-          setConnectionStatus(false);
-          // close notification channel
-          std::lock_guard<decltype(m_notifyReceiverLock)> guard(
-              m_notifyReceiverLock);
-          if (m_numRegionListener > 0) {
-            m_numRegionListener = 0;
-            closeNotification();
-          }
+  while (isRunning && processNotification(isRunning)) {
+  }
+  LOGFINE("Ended subscription channel for endpoint %s", m_name.c_str());
+}
+
+bool TcrEndpoint::processNotification(std::atomic<bool>& isRunning) {
+  TcrMessageReply* msg = nullptr;
+  try {
+    size_t dataLen;
+    ConnErrType opErr = CONN_NOERR;
+    auto data = m_notifyConnection->receive(&dataLen, &opErr,
+                                            std::chrono::seconds(5));
+
+    if (opErr == CONN_IOERR) {
+      // Endpoint is disconnected, this exception is expected
+      LOGFINER(
+          "IO exception while receiving subscription event for endpoint %d",
+          opErr);
+      if (isRunning) {
+        setConnectionStatus(false);
+        // close notification channel
+        std::lock_guard<decltype(m_notifyReceiverLock)> guard(
+            m_notifyReceiverLock);
+        if (m_numRegionListener > 0) {
+          m_numRegionListener = 0;
+          closeNotification();
         }
-        break;
       }
+      return false;
+    }
 
-      if (data) {
-        msg = new TcrMessageReply(true, m_baseDM);
-        msg->initCqMap();
-        msg->setData(data, static_cast<int32_t>(dataLen),
-                     getDistributedMemberID(),
-                     *(m_cacheImpl->getSerializationRegistry()),
-                     *(m_cacheImpl->getMemberListForVersionStamp()));
-        handleNotificationStats(static_cast<int64_t>(dataLen));
-        LOGDEBUG("receive notification %d", msg->getMessageType());
-
-        if (!isRunning) {
-          _GEODE_SAFE_DELETE(msg);
-          break;
-        }
+    if (data) {
+      msg = new TcrMessageReply(true, m_baseDM);
+      msg->initCqMap();
+      msg->setData(data, static_cast<int32_t>(dataLen),
+                   getDistributedMemberID(),
+                   *(m_cacheImpl->getSerializationRegistry()),
+                   *(m_cacheImpl->getMemberListForVersionStamp()));
+      handleNotificationStats(static_cast<int64_t>(dataLen));
+      LOGDEBUG("receive notification %d", msg->getMessageType());
+
+      if (!isRunning) {
+        _GEODE_SAFE_DELETE(msg);
+        return false;
+      }
 
-        if (msg->getMessageType() == TcrMessage::SERVER_TO_CLIENT_PING) {
-          LOGFINE("Received ping from server subscription channel.");
-        }
+      if (msg->getMessageType() == TcrMessage::SERVER_TO_CLIENT_PING) {
+        LOGFINE("Received ping from server subscription channel.");
+      }
 
-        // ignore some message types like REGISTER_INSTANTIATORS
-        if (msg->shouldIgnore()) {
-          _GEODE_SAFE_DELETE(msg);
-          continue;
-        }
+      // ignore some message types like REGISTER_INSTANTIATORS
+      if (msg->shouldIgnore()) {
+        _GEODE_SAFE_DELETE(msg);
+        return true;
+      }
 
-        bool isMarker = (msg->getMessageType() == TcrMessage::CLIENT_MARKER);
-        if (!msg->hasCqPart()) {
-          if (msg->getMessageType() != TcrMessage::CLIENT_MARKER) {
-            const std::string& regionFullPath1 = msg->getRegionName();
-            auto region1 = m_cacheImpl->getRegion(regionFullPath1);
-
-            if (region1 != nullptr &&
-                !static_cast<ThinClientRegion*>(region1.get())
-                     ->getDistMgr()
-                     ->isEndpointAttached(this)) {
-              // drop event before even processing the eventid for duplicate
-              // checking
-              LOGFINER("Endpoint %s dropping event for region %s",
-                       m_name.c_str(), regionFullPath1.c_str());
-              _GEODE_SAFE_DELETE(msg);
-              continue;
-            }
+      bool isMarker = (msg->getMessageType() == TcrMessage::CLIENT_MARKER);
+      std::shared_ptr<Region> region;
+      if (!msg->hasCqPart()) {
+        if (msg->getMessageType() != TcrMessage::CLIENT_MARKER) {
+          region = m_cacheImpl->getRegionHandle(msg->getRegionName());
+
+          if (region != nullptr &&
+              !static_cast<ThinClientRegion*>(region.get())
+                   ->getDistMgr()
+                   ->isEndpointAttached(this)) {
+            // drop event before even processing the eventid for duplicate
+            // checking
+            LOGFINER("Endpoint %s dropping event for region %s",
+                     m_name.c_str(), msg->getRegionName().c_str());
+            _GEODE_SAFE_DELETE(msg);
+            return true;
           }
         }
+      }
 
-        if (!checkDupAndAdd(msg->getEventId())) {
-          m_dupCount++;
-          if (m_dupCount % 100 == 1) {
-            LOGFINE("Dropped %dst duplicate notification message", m_dupCount);
-          }
-          _GEODE_SAFE_DELETE(msg);
-          continue;
+      if (!checkDupAndAdd(msg->getEventId())) {
+        m_dupCount++;
+        if (m_dupCount % 100 == 1) {
+          LOGFINE("Dropped %dst duplicate notification message", m_dupCount);
         }
+        _GEODE_SAFE_DELETE(msg);
+        return true;
+      }
 
-        if (isMarker) {
-          LOGFINE("Got a marker message on endpont %s", m_name.c_str());
-          m_cacheImpl->processMarker();
-          processMarker();
-          _GEODE_SAFE_DELETE(msg);
-        } else {
-          if (!msg->hasCqPart())  // || msg->isInterestListPassed())
-          {
-            const std::string& regionFullPath = msg->getRegionName();
-            auto region = m_cacheImpl->getRegion(regionFullPath);
-
-            if (region != nullptr) {
-              static_cast<ThinClientRegion*>(region.get())
-                  ->receiveNotification(msg);
-            } else {
-              LOGWARN(
-                  "Notification for region %s that does not exist in "
-                  "client cacheImpl.",
-                  regionFullPath.c_str());
-            }
+      if (isMarker) {
+        LOGFINE("Got a marker message on endpont %s", m_name.c_str());
+        m_cacheImpl->processMarker();
+        processMarker();
+        _GEODE_SAFE_DELETE(msg);
+      } else {
+        if (!msg->hasCqPart())  // || msg->isInterestListPassed())
+        {
+          // resolved above, as only markers and CQ events have no region
+          if (region != nullptr) {
+            static_cast<ThinClientRegion*>(region.get())
+                ->receiveNotification(msg);
           } else {
-            LOGDEBUG("receive cq notification %d", msg->getMessageType());
-            auto queryService = getQueryService();
-            if (queryService != nullptr) {
-              static_cast<RemoteQueryService*>(queryService.get())
-                  ->receiveNotification(msg);
-            }
+            LOGWARN(
+                "Notification for region %s that does not exist in "
+                "client cacheImpl.",
+                msg->getRegionName().c_str());
+          }
+        } else {
+          LOGDEBUG("receive cq notification %d", msg->getMessageType());
+          auto queryService = getQueryService();
+          if (queryService != nullptr) {
+            static_cast<RemoteQueryService*>(queryService.get())
+                ->receiveNotification(msg);
           }
         }
       }
-    } catch (const TimeoutException&) {
-      // If there is no notification, this exception is expected
-      // But this is valid only when *no* data has been received
-      // otherwise if data has been read then TcrConnection will throw
-      // a GeodeIOException which will cause the channel to close.
-      LOGDEBUG(
-          "receiveNotification timed out: no data received from "
-          "endpoint %s",
-          m_name.c_str());
-    } catch (const GeodeIOException& e) {
-      // Endpoint is disconnected, this exception is expected
-      LOGFINER(
-          "IO exception while receiving subscription event for endpoint %s: %s",
-          m_name.c_str(), e.what());
-      if (m_connected) {
-        setConnectionStatus(false);
-        // close notification channel
-        std::lock_guard<decltype(m_notifyReceiverLock)> guard(
-            m_notifyReceiverLock);
-        if (m_numRegionListener > 0) {
-          m_numRegionListener = 0;
-          closeNotification();
-        }
+    }
+  } catch (const TimeoutException&) {
+    // If there is no notification, this exception is expected
+    // But this is valid only when *no* data has been received
+    // otherwise if data has been read then TcrConnection will throw
+    // a GeodeIOException which will cause the channel to close.
+    LOGDEBUG(
+        "receiveNotification timed out: no data received from "
+        "endpoint %s",
+        m_name.c_str());
+  } catch (const GeodeIOException& e) {
+    // Endpoint is disconnected, this exception is expected
+    LOGFINER(
+        "IO exception while receiving subscription event for endpoint %s: %s",
+        m_name.c_str(), e.what());
+    if (m_connected) {
+      setConnectionStatus(false);
+      // close notification channel
+      std::lock_guard<decltype(m_notifyReceiverLock)> guard(
+          m_notifyReceiverLock);
+      if (m_numRegionListener > 0) {
+        m_numRegionListener = 0;
+        closeNotification();
       }
-      break;
-    } catch (const Exception& ex) {
-      _GEODE_SAFE_DELETE(msg);
-      LOGERROR(
-          "Exception while receiving subscription event for endpoint %s:: %s: "
-          "%s",
-          m_name.c_str(), ex.getName().c_str(), ex.what());
-    } catch (...) {
-      _GEODE_SAFE_DELETE(msg);
-      LOGERROR(
-          "Unexpected exception while "
-          "receiving subscription event from endpoint %s",
-          m_name.c_str());
     }
+    return false;
+  } catch (const Exception& ex) {
+    _GEODE_SAFE_DELETE(msg);
+    LOGERROR(
+        "Exception while receiving subscription event for endpoint %s:: %s: "
+        "%s",
+        m_name.c_str(), ex.getName().c_str(), ex.what());
+  } catch (...) {
+    _GEODE_SAFE_DELETE(msg);
+    LOGERROR(
+        "Unexpected exception while "
+        "receiving subscription event from endpoint %s",
+        m_name.c_str());
   }
-  LOGFINE("Ended subscription channel for endpoint %s", m_name.c_str());
+  return true;
 }
 
 inline bool TcrEndpoint::compareTransactionIds(int32_t reqTransId,
@@ -32,7 +32,7 @@
 
 #include "ConnectionQueue.hpp"
 #include "ErrType.hpp"
-#include "Task.hpp"
+#include "NotificationReceiver.hpp"
 #include "TcrConnection.hpp"
 #include "util/synchronized_set.hpp"
 
@@ -69,6 +69,12 @@ class TcrEndpoint {
 
   void pingServer(ThinClientPoolDM* poolDM = nullptr);
   void receiveNotification(std::atomic<bool>& isRunning);
+
+  /**
+   * Receives and processes one message of the subscription channel. Returns
+   * false once the channel has failed or been stopped.
+   */
+  bool processNotification(std::atomic<bool>& isRunning);
   GfErrType send(const TcrMessage& request, TcrMessageReply& reply);
   GfErrType sendRequestConn(const TcrMessage& request, TcrMessageReply& reply,
                             TcrConnection* conn, std::string& failReason);
@@ -176,9 +182,9 @@ class TcrEndpoint {
 
  protected:
   TcrConnection* m_notifyConnection;
-  std::unique_ptr<Task<TcrEndpoint>> m_notifyReceiver;
+  std::unique_ptr<NotificationReceiver> m_notifyReceiver;
   CacheImpl* m_cacheImpl;
-  std::list<Task<TcrEndpoint>*> m_notifyReceiverList;
+  std::list<NotificationReceiver*> m_notifyReceiverList;
   std::list<TcrConnection*> m_notifyConnectionList;
   std::timed_mutex m_connectLock;
   std::recursive_mutex m_notifyReceiverLock;
@@ -200,6 +206,12 @@ class TcrEndpoint {
   virtual void handleNotificationStats(int64_t byteLength);
   virtual void closeNotification();
 
+  /**
+   * Starts receiving on m_notifyConnection, through the subscription reactor
+   * if there is one and the connection can be watched by it.
+   */
+  void startNotificationReceiver();
+
   virtual bool handleIOException(const std::string& message,
                                  TcrConnection*& conn, bool isBgThread = false);
 
@@ -31,6 +31,7 @@
 #include "DiskVersionTag.hpp"
 #include "DistributedSystem.hpp"
 #include "StackTrace.hpp"
+#include "StoredValue.hpp"
 #include "TSSTXStateWrapper.hpp"
 #include "TXState.hpp"
 #include "TcrChunkedContext.hpp"
@@ -177,6 +178,7 @@ TcrMessage::TcrMessage()
       m_serverGroupVersion(0),
       m_boolValue(0),
       m_isCallBackArguement(false),
+      m_deferValueDeserialization(false),
       m_hasResult(0) {}
 
 const std::vector<std::shared_ptr<CacheableKey>>* TcrMessage::getKeys() const {
@@ -322,6 +324,10 @@ void TcrMessage::setCallBackArguement(bool aCallBackArguement) {
   m_isCallBackArguement = aCallBackArguement;
 }
 
+void TcrMessage::setDeferValueDeserialization(bool deferValueDeserialization) {
+  m_deferValueDeserialization = deferValueDeserialization;
+}
+
 void TcrMessage::setBucketServerLocation(
     std::shared_ptr<BucketServerLocation> serverLocation) {
   m_bucketServerLocation = serverLocation;
@@ -485,11 +491,12 @@ const std::string TcrMessage::readStringPart(DataInput& input) {
   if (input.read()) {
     throw Exception("String is not an object");
   }
-  auto jmutf8 = internal::JavaModifiedUtf8::decode(
+  std::string value;
+  internal::JavaModifiedUtf8::decode(
       reinterpret_cast<const char*>(input.currentBufferPosition()),
-      stringLength);
+      stringLength, value);
   input.advanceCursor(stringLength);
-  return to_utf8(jmutf8);
+  return value;
 }
 
 void TcrMessage::readCqsPart(DataInput& input) {
@@ -521,11 +528,17 @@ void TcrMessage::readCallbackObjectPart(DataInput& input, bool defaultString) {
   }
 }
 
-void TcrMessage::readObjectPart(DataInput& input, bool defaultString) {
+void TcrMessage::readObjectPart(DataInput& input, bool defaultString,
+                                bool deferDeserialization) {
   int32_t lenObj = input.readInt32();
   auto isObj = input.read();
   if (lenObj > 0) {
-    if (isObj == 1) {
+    if (isObj == 1 && deferDeserialization) {
+      auto bytes = input.currentBufferPosition();
+      m_value = std::make_shared<StoredValue>(
+          std::vector<uint8_t>(bytes, bytes + lenObj), 0);
+      input.advanceCursor(lenObj);
+    } else if (isObj == 1) {
       input.readObject(m_value);
     } else {
       if (defaultString) {
@@ -628,6 +641,13 @@ int64_t TcrMessage::getUniqueId() {
   return 0;
 }
 
+bool TcrMessage::regionStoresSerializedValues() const {
+  auto region = std::dynamic_pointer_cast<LocalRegion>(
+      m_tcdm->getConnectionManager().getCacheImpl()->getRegionHandle(
+          m_regionName));
+  return region && region->storesSerializedValues();
+}
+
 void TcrMessage::readFailedNodePart(DataInput& input) {
   // read and ignore length
   input.readInt32();
@@ -1242,7 +1262,7 @@ void TcrMessage::handleByteArrayResponse(
         m_functionAttributes->push_back(input.read());
       } else if (m_msgTypeRequest == TcrMessage::REQUEST) {
         int32_t receivednumparts = 2;
-        readObjectPart(input);
+        readObjectPart(input, false, m_deferValueDeserialization);
         uint32_t flag = 0;
         readIntPart(input, &flag);
         if (flag & 0x01) {
@@ -1445,7 +1465,7 @@ void TcrMessage::handleByteArrayResponse(
                 reinterpret_cast<const uint8_t*>(m_deltaBytes),
                 m_deltaBytesLen)));
       } else {
-        readObjectPart(input);
+        readObjectPart(input, false, regionStoresSerializedValues());
       }
 
       // skip callbackarg part
@@ -3086,7 +3106,21 @@ std::shared_ptr<CacheableKey> TcrMessage::getKey() const { return m_key; }
 const std::shared_ptr<CacheableKey>& TcrMessage::getKeyRef() const {
   return m_key;
 }
-std::shared_ptr<Cacheable> TcrMessage::getValue() const { return m_value; }
+std::shared_ptr<Cacheable> TcrMessage::getValue() const {
+  if (auto stored = std::dynamic_pointer_cast<StoredValue>(m_value)) {
+    auto pool = getPool();
+    if (!pool) {
+      pool = dynamic_cast<ThinClientPoolDM*>(m_tcdm);
+    }
+    m_value = stored->deserialize(
+        *m_tcdm->getConnectionManager().getCacheImpl(), pool);
+  }
+  return m_value;
+}
+
+std::shared_ptr<Cacheable> TcrMessage::getSerializedValue() const {
+  return m_value;
+}
 
 const std::shared_ptr<Cacheable>& TcrMessage::getValueRef() const {
   return m_value;
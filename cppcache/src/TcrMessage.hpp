@@ -238,6 +238,13 @@ class TcrMessage {
   const std::shared_ptr<CacheableKey>& getKeyRef() const;
   std::shared_ptr<Cacheable> getValue() const;
   const std::shared_ptr<Cacheable>& getValueRef() const;
+
+  /**
+   * Returns the value as received: a StoredValue holding its serialized
+   * bytes if deserialization was deferred, see
+   * setDeferValueDeserialization. getValue deserializes such a value.
+   */
+  std::shared_ptr<Cacheable> getSerializedValue() const;
   std::shared_ptr<Cacheable> getCallbackArgument() const;
   const std::shared_ptr<Cacheable>& getCallbackArgumentRef() const;
 
@@ -334,6 +341,13 @@ class TcrMessage {
 
   void setCallBackArguement(bool aCallBackArguement);
 
+  /**
+   * Keeps the value of a get response serialized until getValue is called,
+   * for regions storing values serialized. The values of subscription
+   * events are kept serialized if the region they are for stores them so.
+   */
+  void setDeferValueDeserialization(bool deferValueDeserialization);
+
   void setBucketServerLocation(
       std::shared_ptr<BucketServerLocation> serverLocation);
   void setVersionTag(std::shared_ptr<VersionTag> versionTag);
@@ -362,8 +376,10 @@ class TcrMessage {
       const char* bytearray, int32_t len, uint16_t endpointMemId,
       const SerializationRegistry& serializationRegistry,
       MemberListForVersionStamp& memberListForVersionStamp);
-  void readObjectPart(DataInput& input, bool defaultString = false);
+  void readObjectPart(DataInput& input, bool defaultString = false,
+                      bool deferDeserialization = false);
   void readFailedNodePart(DataInput& input);
+  bool regionStoresSerializedValues() const;
   void readCallbackObjectPart(DataInput& input, bool defaultString = false);
   void readKeyPart(DataInput& input);
   void readBooleanPartAsObject(DataInput& input, bool* boolVal);
@@ -424,7 +440,8 @@ class TcrMessage {
   std::shared_ptr<CacheableBytes> m_connectionIDBytes;
   std::shared_ptr<Properties> m_creds;
   std::shared_ptr<CacheableKey> m_key;
-  std::shared_ptr<Cacheable> m_value;
+  // deserialized by getValue if it was received as a StoredValue
+  mutable std::shared_ptr<Cacheable> m_value;
   std::shared_ptr<CacheableHashSet> m_failedNode;
   std::shared_ptr<Cacheable> m_callbackArgument;
   std::shared_ptr<VersionTag> m_versionTag;
@@ -468,6 +485,7 @@ class TcrMessage {
   int8_t m_serverGroupVersion;
   bool m_boolValue;
   bool m_isCallBackArguement;
+  bool m_deferValueDeserialization;
   uint8_t m_hasResult;
 
   static std::atomic<int32_t> m_transactionId;
@@ -92,9 +92,7 @@ GfErrType TcrPoolEndPoint::registerDM(bool, bool isSecondary, bool,
               name().c_str());
       return err;
     }
-    m_notifyReceiver = std::unique_ptr<Task<TcrEndpoint>>(new Task<TcrEndpoint>(
-        this, &TcrEndpoint::receiveNotification, NC_Notification));
-    m_notifyReceiver->start();
+    startNotificationReceiver();
   }
   ++m_numRegionListener;
   LOGFINEST("Incremented notification count for endpoint %s to %d",
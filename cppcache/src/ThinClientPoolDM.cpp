@@ -205,6 +205,8 @@ ThinClientPoolDM::ThinClientPoolDM(const char* name,
         std::unique_ptr<ClientMetadataService>(new ClientMetadataService(this));
   }
   m_manager = new ThinClientStickyManager(this);
+  m_threadAffine = m_attrs->getThreadAffineConnectionSetting() &&
+                   !m_attrs->getThreadLocalConnectionSetting();
 }
 
 void ThinClientPoolDM::init() {
@@ -533,6 +535,8 @@ void ThinClientPoolDM::manageConnectionsInternal(std::atomic<bool>& isRunning) {
         "queue %zu",
         size());
 
+    reclaimAffineConnections(false);
+
     cleanStaleConnections(isRunning);
 
     cleanStickyConnections(isRunning);
@@ -805,6 +809,8 @@ void ThinClientPoolDM::destroy(bool keepAlive) {
         "ThinClientPoolDM::destroy( ): closing ConnectionQueue, pool size = "
         "%d",
         m_poolSize.load());
+    m_affineConnections.close(
+        [this](TcrConnection* conn) { put(conn, false); });
     close();
     LOGDEBUG("ThinClientPoolDM::destroy( ): after close ");
 
@@ -1792,6 +1798,13 @@ TcrConnection* ThinClientPoolDM::getConnectionFromQueue(
     bool& maxConnLimit) {
   std::chrono::microseconds timeoutTime = m_attrs->getFreeConnectionTimeout();
 
+  if (m_threadAffine && m_attrs->getMaxConnections() > 0 &&
+      m_poolSize >= m_attrs->getMaxConnections() && empty()) {
+    // connections parked with other threads are idle, hand them back
+    // rather than waiting for a free one
+    reclaimAffineConnections(true);
+  }
+
   getStats().incCurWaitingConnections();
   getStats().incWaitingConnections();
 
@@ -2128,33 +2141,33 @@ bool ThinClientPoolDM::excludeConnection(
 
 TcrConnection* ThinClientPoolDM::getFromEP(TcrEndpoint* theEP) {
   std::lock_guard<decltype(mutex_)> lock(mutex_);
-  for (auto itr = queue_.begin(); itr != queue_.end(); itr++) {
-    if ((*itr)->getEndpointObject() == theEP) {
-      LOGDEBUG("ThinClientPoolDM::getFromEP got connection");
-      TcrConnection* retVal = *itr;
-      queue_.erase(itr);
-      return retVal;
-    }
+  auto conn = popNoLock(static_cast<const void*>(theEP));
+  if (conn) {
+    LOGDEBUG("ThinClientPoolDM::getFromEP got connection");
   }
-
-  return nullptr;
+  return conn;
 }
 
 void ThinClientPoolDM::removeEPConnections(TcrEndpoint* theEP) {
   std::lock_guard<decltype(mutex_)> lock(mutex_);
-  auto size = static_cast<int32_t>(queue_.size());
   int numConn = 0;
 
-  while (size--) {
-    TcrConnection* curConn = queue_.back();
-    queue_.pop_back();
-    if (curConn->getEndpointObject() != theEP) {
-      queue_.push_front(curConn);
-    } else {
-      curConn->close();
-      _GEODE_SAFE_DELETE(curConn);
-      numConn++;
-    }
+  while (auto curConn = popNoLock(static_cast<const void*>(theEP))) {
+    curConn->close();
+    _GEODE_SAFE_DELETE(curConn);
+    numConn++;
+  }
+
+  if (m_threadAffine) {
+    m_affineConnections.reclaim(
+        [theEP](TcrConnection* conn) {
+          return conn->getEndpointObject() == theEP;
+        },
+        [&numConn](TcrConnection* conn) {
+          conn->close();
+          _GEODE_SAFE_DELETE(conn);
+          numConn++;
+        });
   }
 
   removeEPConnections(numConn);
@@ -2263,15 +2276,47 @@ GfErrType ThinClientPoolDM::doFailover(TcrConnection* conn) {
 
 bool ThinClientPoolDM::canItBeDeletedNoImpl(TcrConnection*) { return false; }
 
-void ThinClientPoolDM::putInQueue(TcrConnection* conn, bool,
+void ThinClientPoolDM::putInQueue(TcrConnection* conn, bool isBGThread,
                                   bool isTransaction) {
   if (isTransaction) {
     m_manager->setStickyConnection(conn, isTransaction);
+  } else if (m_threadAffine && !isBGThread) {
+    m_affineConnections.put(
+        conn->getEndpointObject(), conn,
+        [this](TcrConnection* evicted) { put(evicted, false); });
   } else {
     put(conn, false);
   }
 }
 
+TcrConnection* ThinClientPoolDM::getAffineConnection(
+    TcrEndpoint* theEP, std::set<ServerLocation>& excludeServers) {
+  if (!m_threadAffine) {
+    return nullptr;
+  }
+
+  auto conn = m_affineConnections.take(theEP);
+  if (conn && excludeConnection(conn, excludeServers)) {
+    put(conn, false);
+    conn = nullptr;
+  }
+  return conn;
+}
+
+void ThinClientPoolDM::reclaimAffineConnections(bool all) {
+  if (!m_threadAffine) {
+    return;
+  }
+
+  auto idle = getIdleTimeout();
+  if (idle <= std::chrono::milliseconds::zero()) {
+    idle = getLoadConditioningInterval();
+  }
+  m_affineConnections.reclaim(
+      [all, idle](TcrConnection* conn) { return all || conn->isIdle(idle); },
+      [this](TcrConnection* conn) { put(conn, false); });
+}
+
 TcrConnection* ThinClientPoolDM::getConnectionFromQueueW(
     GfErrType* error, std::set<ServerLocation>& excludeServers, bool,
     TcrMessage& request, int8_t& version, bool& match, bool& connFound,
@@ -2322,7 +2367,10 @@ TcrConnection* ThinClientPoolDM::getConnectionFromQueueW(
   }
   bool maxConnLimit = false;
   if (theEP != nullptr) {
-    conn = getFromEP(theEP);
+    conn = getAffineConnection(theEP, excludeServers);
+    if (!conn) {
+      conn = getFromEP(theEP);
+    }
     if (!conn) {
       LOGFINER("Creating connection to endpoint as not found in pool ");
       *error = createPoolConnectionToAEndPoint(conn, theEP, maxConnLimit, true);
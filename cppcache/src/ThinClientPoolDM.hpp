@@ -45,6 +45,7 @@
 #include "ThinClientLocatorHelper.hpp"
 #include "ThinClientRegion.hpp"
 #include "ThinClientStickyManager.hpp"
+#include "ThreadAffineConnections.hpp"
 #include "ThreadPool.hpp"
 #include "UserAttributes.hpp"
 
@@ -185,6 +186,8 @@ class ThinClientPoolDM
 
  protected:
   ThinClientStickyManager* m_manager;
+  ThreadAffineConnections<TcrConnection> m_affineConnections;
+  bool m_threadAffine;
   std::vector<std::string> m_canonicalHosts;
   synchronized_map<std::unordered_map<std::string, TcrEndpoint*>,
                    std::recursive_mutex>
@@ -226,6 +229,9 @@ class ThinClientPoolDM
       const std::shared_ptr<BucketServerLocation>& serverLocation = nullptr);
 
   TcrConnection* getFromEP(TcrEndpoint* theEP);
+  TcrConnection* getAffineConnection(TcrEndpoint* theEP,
+                                     std::set<ServerLocation>& excludeServers);
+  void reclaimAffineConnections(bool all);
   virtual TcrEndpoint* getSingleHopServer(
       TcrMessage& request, int8_t& version,
       std::shared_ptr<BucketServerLocation>& serverLocation,
@@ -269,6 +275,9 @@ class ThinClientPoolDM
                               bool& maxConnLimit);
   bool exclude(TcrConnection* conn, std::set<ServerLocation>& excludeServers);
   void deleteAction() override { removeEPConnections(1); }
+  const void* partitionOf(const TcrConnection* conn) const override {
+    return conn->getEndpointObject();
+  }
 
   std::string selectEndpoint(std::set<ServerLocation>&,
                              const TcrConnection* currentServer = nullptr);
@@ -20,6 +20,7 @@
 #include <algorithm>
 #include <limits>
 #include <regex>
+#include <thread>
 
 #include <geode/PoolManager.hpp>
 #include <geode/Struct.hpp>
@@ -30,6 +31,7 @@
 #include "CacheImpl.hpp"
 #include "CacheRegionHelper.hpp"
 #include "DataInputInternal.hpp"
+#include "PdxInstanceImpl.hpp"
 #include "PutAllPartialResultServerException.hpp"
 #include "ReadWriteLock.hpp"
 #include "RegionGlobalLocks.hpp"
@@ -907,13 +909,14 @@ GfErrType ThinClientRegion::getNoThrow_remote(
   TcrMessageRequest request(new DataOutput(m_cacheImpl->createDataOutput()),
                             this, keyPtr, aCallbackArgument, m_tcrdm.get());
   TcrMessageReply reply(true, m_tcrdm.get());
+  reply.setDeferValueDeserialization(storesSerializedValues());
   err = m_tcrdm->sendSyncRequest(request, reply);
   if (err != GF_NOERR) return err;
 
   // put the object into local region
   switch (reply.getMessageType()) {
     case TcrMessage::RESPONSE: {
-      valPtr = reply.getValue();
+      valPtr = reply.getSerializedValue();
       versionTag = reply.getVersionTag();
       break;
     }
@@ -982,14 +985,14 @@ GfErrType ThinClientRegion::putNoThrow_remote(
   // do TCR put
   // bool delta = valuePtr->hasDelta();
   bool delta = false;
-  auto&& conFlationValue = getCacheImpl()
-                               ->getDistributedSystem()
-                               .getSystemProperties()
-                               .conflateEvents();
+  auto&& sysProp = getCacheImpl()->getDistributedSystem().getSystemProperties();
+  auto&& conFlationValue = sysProp.conflateEvents();
   if (checkDelta && valuePtr && conFlationValue != "true" &&
       ThinClientBaseDM::isDeltaEnabledOnServer()) {
     auto&& temp = std::dynamic_pointer_cast<Delta>(valuePtr);
-    delta = temp && temp->hasDelta();
+    delta = temp && temp->hasDelta() &&
+            (sysProp.pdxInstanceDeltaEnabled() ||
+             std::dynamic_pointer_cast<PdxInstanceImpl>(valuePtr) == nullptr);
   }
   TcrMessagePut request(new DataOutput(m_cacheImpl->createDataOutput()), this,
                         keyPtr, valuePtr, aCallbackArgument, delta,
@@ -2653,6 +2656,9 @@ ThinClientRegion::getInterestListRegex() const {
 GfErrType ThinClientRegion::clientNotificationHandler(TcrMessage& msg) {
   GfErrType err = GF_NOERR;
   std::shared_ptr<Cacheable> oldValue;
+  // regions keeping values serialized take them as received
+  const auto value =
+      storesSerializedValues() ? msg.getSerializedValue() : msg.getValue();
   switch (msg.getMessageType()) {
     case TcrMessage::LOCAL_INVALIDATE: {
       LocalRegion::invalidateNoThrow(
@@ -2684,7 +2690,7 @@ GfErrType ThinClientRegion::clientNotificationHandler(TcrMessage& msg) {
     }
     case TcrMessage::LOCAL_CREATE:
       err = LocalRegion::putNoThrow(
-          msg.getKey(), msg.getValue(), msg.getCallbackArgument(), oldValue, -1,
+          msg.getKey(), value, msg.getCallbackArgument(), oldValue, -1,
           CacheEventFlags::NOTIFICATION | CacheEventFlags::LOCAL,
           msg.getVersionTag());
       break;
@@ -2692,7 +2698,7 @@ GfErrType ThinClientRegion::clientNotificationHandler(TcrMessage& msg) {
       //  for update set the NOTIFICATION_UPDATE to trigger the
       // afterUpdate event even if the key is not present in local cache
       err = LocalRegion::putNoThrow(
-          msg.getKey(), msg.getValue(), msg.getCallbackArgument(), oldValue, -1,
+          msg.getKey(), value, msg.getCallbackArgument(), oldValue, -1,
           CacheEventFlags::NOTIFICATION | CacheEventFlags::NOTIFICATION_UPDATE |
               CacheEventFlags::LOCAL,
           msg.getVersionTag(), msg.getDelta(), msg.getEventId());
@@ -3689,13 +3695,67 @@ void ChunkedFunctionExecutionResponse::handleChunk(
   //  m_functionExecutionResults->push_back(value);
 }
 
+/**
+ * Decodes one chunk of an interest registration's initial image and puts its
+ * entries into the region. The chunk is copied, as the connection reuses its
+ * buffer for the next one.
+ */
+class ChunkedGetAllResponse::ChunkDecoder
+    : public PooledWork<std::shared_ptr<Exception>> {
+ public:
+  ChunkDecoder(ChunkedGetAllResponse& response, const uint8_t* chunk,
+               int32_t chunkLen, size_t offset, const CacheImpl* cacheImpl)
+      : m_response(response),
+        m_chunk(chunk, chunk + chunkLen),
+        m_offset(offset),
+        m_cacheImpl(cacheImpl) {}
+
+ protected:
+  std::shared_ptr<Exception> execute() override {
+    try {
+      auto input = m_cacheImpl->createDataInput(
+          m_chunk.data(), m_chunk.size(), m_response.m_msg.getPool());
+      input.advanceCursor(m_offset);
+      m_response.decodeChunk(input);
+    } catch (const Exception& ex) {
+      LOGERROR("HandleChunk error message %s, name = %s", ex.what(),
+               ex.getName().c_str());
+      return std::make_shared<Exception>(ex);
+    } catch (const std::exception& ex) {
+      LOGERROR("HandleChunk exception: %s", ex.what());
+      return std::make_shared<UnknownException>(
+          std::string("HandleChunk exception:: ") + ex.what());
+    } catch (...) {
+      LOGERROR("Unknown exception while decoding a registerInterest chunk");
+      return std::make_shared<UnknownException>(
+          "Unknown exception in ChunkedGetAllResponse::handleChunk while "
+          "processing response, possible serialization mismatch");
+    }
+    return nullptr;
+  }
+
+ private:
+  ChunkedGetAllResponse& m_response;
+  const std::vector<uint8_t> m_chunk;
+  const size_t m_offset;
+  const CacheImpl* m_cacheImpl;
+};
+
+ChunkedGetAllResponse::~ChunkedGetAllResponse() { joinDecoders(0); }
+
 void ChunkedGetAllResponse::reset() {
+  joinDecoders(0);
   m_keysOffset = 0;
   if (m_resultKeys != nullptr && m_resultKeys->size() > 0) {
     m_resultKeys->clear();
   }
 }
 
+void ChunkedGetAllResponse::finalize(bool inSameThread) {
+  joinDecoders(0);
+  TcrChunkedResult::finalize(inSameThread);
+}
+
 // process a GET_ALL response chunk
 void ChunkedGetAllResponse::handleChunk(const uint8_t* chunk, int32_t chunkLen,
                                         uint8_t isLastChunkWithSecurity,
@@ -3713,6 +3773,21 @@ void ChunkedGetAllResponse::handleChunk(const uint8_t* chunk, int32_t chunkLen,
     return;
   }
 
+  // Chunks carrying their own keys, as the initial image of a regex or all
+  // keys registration does, do not depend on each other and are decoded in
+  // parallel. Only the last chunk may carry a security part for m_msg.
+  if (m_keys == nullptr && m_addToLocalCache && m_region != nullptr &&
+      !(isLastChunkWithSecurity & 0x2)) {
+    static const size_t maxChunksInFlight =
+        std::max(2u, 2 * std::thread::hardware_concurrency());
+    joinDecoders(maxChunksInFlight - 1);
+    auto decoder = std::make_shared<ChunkDecoder>(
+        *this, chunk, chunkLen, input.getBytesRead(), cacheImpl);
+    m_decoders.push_back(decoder);
+    m_region->getCacheImpl()->getThreadPool().perform(decoder);
+    return;
+  }
+
   VersionedCacheableObjectPartList objectList(
       m_keys, &m_keysOffset, m_values, m_exceptions, m_resultKeys, m_region,
       &m_trackerMap, m_destroyTracker, m_addToLocalCache, m_dsmemId,
@@ -3723,6 +3798,48 @@ void ChunkedGetAllResponse::handleChunk(const uint8_t* chunk, int32_t chunkLen,
   m_msg.readSecureObjectPart(input, false, true, isLastChunkWithSecurity);
 }
 
+void ChunkedGetAllResponse::decodeChunk(DataInput& input) {
+  // decode and put into the region without holding the response lock, then
+  // merge the results
+  auto values = std::make_shared<HashMapOfCacheable>();
+  auto exceptions = std::make_shared<HashMapOfException>();
+  auto resultKeys =
+      std::make_shared<std::vector<std::shared_ptr<CacheableKey>>>();
+  std::recursive_mutex chunkLock;
+  VersionedCacheableObjectPartList objectList(
+      nullptr, nullptr, values, exceptions, resultKeys, m_region,
+      &m_trackerMap, m_destroyTracker, m_addToLocalCache, m_dsmemId,
+      chunkLock);
+
+  objectList.fromData(input);
+
+  std::lock_guard<decltype(m_responseLock)> guard(m_responseLock);
+  if (m_values) {
+    m_values->insert(values->begin(), values->end());
+  }
+  if (m_exceptions) {
+    m_exceptions->insert(exceptions->begin(), exceptions->end());
+  }
+  if (m_resultKeys) {
+    m_resultKeys->insert(m_resultKeys->end(), resultKeys->begin(),
+                         resultKeys->end());
+  }
+}
+
+void ChunkedGetAllResponse::joinDecoders(size_t remaining) {
+  while (m_decoders.size() > remaining) {
+    auto decoder = std::move(m_decoders.front());
+    m_decoders.pop_front();
+    // runs the decoder right here if no pool thread has started it yet, so
+    // the reader is not held up by a pool busy with other work
+    if (auto ex = decoder->runOrGetResult()) {
+      if (!exceptionOccurred()) {
+        setException(ex);
+      }
+    }
+  }
+}
+
 void ChunkedGetAllResponse::add(const ChunkedGetAllResponse* other) {
   if (m_values) {
     for (const auto& iter : *m_values) {
@@ -20,10 +20,12 @@
 #ifndef GEODE_THINCLIENTREGION_H_
 #define GEODE_THINCLIENTREGION_H_
 
+#include <deque>
 #include <mutex>
 #include <unordered_map>
 
 #include <geode/ResultCollector.hpp>
+#include <geode/StreamingResultCollector.hpp>
 #include <geode/internal/functional.hpp>
 
 #include "CacheableObjectPartList.hpp"
@@ -475,7 +477,12 @@ class ChunkedFunctionExecutionResponse : public TcrChunkedResult {
         m_msg(msg),
         m_getResult(getResult),
         m_rc(rc),
-        m_resultCollectorLock(resultCollectorLock) {}
+        // results of parallel executions are added to a streaming collector
+        // without any lock
+        m_resultCollectorLock(
+            std::dynamic_pointer_cast<StreamingResultCollector>(rc)
+                ? nullptr
+                : resultCollectorLock) {}
 
   /* inline const std::shared_ptr<CacheableVector>&
    getFunctionExecutionResults() const
@@ -513,10 +520,23 @@ class ChunkedGetAllResponse : public TcrChunkedResult {
   bool m_addToLocalCache;
   uint32_t m_keysOffset;
   std::recursive_mutex& m_responseLock;
+
+  /**
+   * Chunks of an interest registration's initial image being decoded and
+   * put into the region on the cache's thread pool, oldest first.
+   */
+  class ChunkDecoder;
+  std::deque<std::shared_ptr<ChunkDecoder>> m_decoders;
+
   // disabled
   ChunkedGetAllResponse(const ChunkedGetAllResponse&);
   ChunkedGetAllResponse& operator=(const ChunkedGetAllResponse&);
 
+  void decodeChunk(DataInput& input);
+
+  /** Waits until at most <code>remaining</code> chunks are still decoded. */
+  void joinDecoders(size_t remaining);
+
  public:
   inline ChunkedGetAllResponse(
       TcrMessage& msg, ThinClientRegion* region,
@@ -540,10 +560,13 @@ class ChunkedGetAllResponse : public TcrChunkedResult {
         m_keysOffset(0),
         m_responseLock(responseLock) {}
 
+  ~ChunkedGetAllResponse() override;
+
   virtual void handleChunk(const uint8_t* chunk, int32_t chunkLen,
                            uint8_t isLastChunkWithSecurity,
                            const CacheImpl* cacheImpl);
   virtual void reset();
+  void finalize(bool inSameThread) override;
 
   void add(const ChunkedGetAllResponse* other);
   bool getAddToLocalCache() { return m_addToLocalCache; }
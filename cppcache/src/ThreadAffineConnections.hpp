@@ -0,0 +1,266 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_THREADAFFINECONNECTIONS_H_
+#define GEODE_THREADAFFINECONNECTIONS_H_
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * Small per thread cache of connections in front of a connection pool.
+ *
+ * A thread returning a connection keeps it in one of its own slots, filed
+ * under a partition (the endpoint for pooled connections). Each thread keeps
+ * at most one connection per partition. The next take for that partition by
+ * the same thread is served from those slots without touching the pool.
+ *
+ * Slots are only ever filled by their own thread. Any thread may empty them
+ * through reclaim, which is how idle connections, connections of failed
+ * endpoints and connections of exited threads find their way back to the
+ * pool. Every hand over is an atomic exchange, so a connection is owned by
+ * exactly one party at any time. A connection reclaim keeps goes back into
+ * its slot only if the owner has not touched the slot meanwhile, since the
+ * owner may have filed the slot under another partition.
+ */
+template <class T>
+class ThreadAffineConnections {
+ public:
+  static const size_t SLOTS_PER_THREAD = 4;
+
+  ThreadAffineConnections() : id_(nextId()), closed_(false) {}
+
+  ThreadAffineConnections(const ThreadAffineConnections&) = delete;
+  ThreadAffineConnections& operator=(const ThreadAffineConnections&) = delete;
+
+  /**
+   * Takes the calling thread's connection for <code>partition</code>.
+   * Returns nullptr if there is none.
+   */
+  T* take(const void* partition) {
+    auto& slots = threadSlots(false);
+    if (!slots) {
+      return nullptr;
+    }
+
+    for (auto& slot : slots->slots) {
+      if (slot.partition == partition) {
+        auto mp = slot.value.exchange(nullptr);
+        return mp == reclaiming() ? nullptr : mp;
+      }
+    }
+    return nullptr;
+  }
+
+  /**
+   * Caches <code>value</code> for the calling thread. Connections that can
+   * not be cached, the one cached before for the same partition, the least
+   * recently used one evicted to make room or <code>value</code> itself once
+   * the cache is closed, are passed to <code>release</code>.
+   */
+  template <class Release>
+  void put(const void* partition, T* value, Release release) {
+    if (closed_) {
+      release(value);
+      return;
+    }
+
+    auto& slots = threadSlots(true);
+    Slot* target = nullptr;
+    for (auto& slot : slots->slots) {
+      if (slot.partition == partition) {
+        target = &slot;
+        break;
+      }
+      if (target == nullptr ||
+          (target->value.load(std::memory_order_relaxed) &&
+           (!slot.value.load(std::memory_order_relaxed) ||
+            slot.lastUse < target->lastUse))) {
+        target = &slot;
+      }
+    }
+
+    target->partition = partition;
+    target->lastUse = ++slots->uses;
+    auto evicted = target->value.exchange(value);
+    if (evicted && evicted != reclaiming()) {
+      release(evicted);
+    }
+
+    // pairs with close(), either close sees the cached connection or this
+    // thread sees the cache closed
+    if (closed_) {
+      auto mp = target->value.exchange(nullptr);
+      if (mp && mp != reclaiming()) {
+        release(mp);
+      }
+    }
+  }
+
+  /**
+   * Empties every slot of every thread whose connection satisfies
+   * <code>predicate</code>, then passes those connections to
+   * <code>release</code>. Connections cached by threads that have exited are
+   * always released.
+   */
+  template <class Predicate, class Release>
+  void reclaim(Predicate predicate, Release release) {
+    std::vector<T*> released;
+    {
+      std::lock_guard<decltype(mutex_)> lock(mutex_);
+      for (auto it = threads_.begin(); it != threads_.end();) {
+        const bool exited = it->use_count() == 1;
+        for (auto& slot : (*it)->slots) {
+          reclaimSlot(slot, exited, predicate, released);
+        }
+        if (exited) {
+          it = threads_.erase(it);
+        } else {
+          ++it;
+        }
+      }
+    }
+
+    for (auto mp : released) {
+      release(mp);
+    }
+  }
+
+  /**
+   * Stops caching and releases all cached connections.
+   */
+  template <class Release>
+  void close(Release release) {
+    closed_ = true;
+    reclaim([](T*) { return true; }, release);
+  }
+
+  bool closed() const { return closed_; }
+
+ private:
+  struct Slot {
+    Slot() : partition(nullptr), lastUse(0), value(nullptr) {}
+
+    // partition and lastUse are only touched by the owning thread
+    const void* partition;
+    uint64_t lastUse;
+    std::atomic<T*> value;
+  };
+
+  struct ThreadSlots {
+    ThreadSlots() : uses(0) {}
+
+    uint64_t uses;
+    std::array<Slot, SLOTS_PER_THREAD> slots;
+  };
+
+  typedef std::vector<std::pair<uint64_t, std::shared_ptr<ThreadSlots>>>
+      ThreadSlotsList;
+
+  const uint64_t id_;
+  std::atomic<bool> closed_;
+  std::mutex mutex_;
+  std::vector<std::shared_ptr<ThreadSlots>> threads_;
+
+  static uint64_t nextId() {
+    static std::atomic<uint64_t> id(0);
+    return ++id;
+  }
+
+  static ThreadSlotsList& threadSlotsList() {
+    static thread_local ThreadSlotsList list;
+    return list;
+  }
+
+  std::shared_ptr<ThreadSlots>& threadSlots(bool create) {
+    static thread_local std::shared_ptr<ThreadSlots> none;
+
+    auto& list = threadSlotsList();
+    for (auto& entry : list) {
+      if (entry.first == id_) {
+        return entry.second;
+      }
+    }
+    if (!create) {
+      return none;
+    }
+
+    // drop the slots of caches that have since been destroyed
+    list.erase(std::remove_if(list.begin(), list.end(),
+                              [](const typename ThreadSlotsList::value_type&
+                                     entry) {
+                                return entry.second.use_count() == 1;
+                              }),
+               list.end());
+
+    auto slots = std::make_shared<ThreadSlots>();
+    {
+      std::lock_guard<decltype(mutex_)> lock(mutex_);
+      threads_.push_back(slots);
+    }
+    list.emplace_back(id_, std::move(slots));
+    return list.back().second;
+  }
+
+  /**
+   * Marks a slot whose connection is being looked at by reclaim. Only one
+   * reclaim runs at a time, so a single mark does.
+   */
+  static T* reclaiming() {
+    static std::max_align_t mark;
+    return reinterpret_cast<T*>(&mark);
+  }
+
+  template <class Predicate>
+  static void reclaimSlot(Slot& slot, bool exited, Predicate& predicate,
+                          std::vector<T*>& released) {
+    auto mp = slot.value.exchange(reclaiming());
+    T* kept = nullptr;
+    if (mp) {
+      if (exited || predicate(mp)) {
+        released.push_back(mp);
+      } else {
+        kept = mp;
+      }
+    }
+
+    auto expected = reclaiming();
+    if (!slot.value.compare_exchange_strong(expected, kept) && kept) {
+      // the owner took, refilled or relabelled the slot meanwhile
+      released.push_back(kept);
+    }
+  }
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_THREADAFFINECONNECTIONS_H_
@@ -25,67 +25,144 @@ namespace client {
 
 const char* ThreadPool::NC_Pool_Thread = "NC Pool Thread";
 
+namespace {
+
+// the pool and queue of the calling pool thread, if any
+thread_local const ThreadPool* currentPool = nullptr;
+thread_local size_t currentQueue = 0;
+
+}  // namespace
+
+bool isPoolThread() { return currentPool != nullptr; }
+
+void ThreadPool::WorkQueue::push(std::shared_ptr<Callable>&& work) {
+  std::lock_guard<decltype(mutex_)> lock(mutex_);
+  if (size_ == buffer_.size()) {
+    std::vector<std::shared_ptr<Callable>> buffer(buffer_.size() * 2);
+    for (size_t i = 0; i < size_; i++) {
+      buffer[i] = std::move(buffer_[(head_ + i) & (buffer_.size() - 1)]);
+    }
+    buffer_.swap(buffer);
+    head_ = 0;
+  }
+  buffer_[(head_ + size_++) & (buffer_.size() - 1)] = std::move(work);
+}
+
+std::shared_ptr<Callable> ThreadPool::WorkQueue::popNewest() {
+  std::lock_guard<decltype(mutex_)> lock(mutex_);
+  if (size_ == 0) {
+    return nullptr;
+  }
+  return std::move(buffer_[(head_ + --size_) & (buffer_.size() - 1)]);
+}
+
+std::shared_ptr<Callable> ThreadPool::WorkQueue::popOldest() {
+  std::lock_guard<decltype(mutex_)> lock(mutex_);
+  if (size_ == 0) {
+    return nullptr;
+  }
+  auto work = std::move(buffer_[head_]);
+  head_ = (head_ + 1) & (buffer_.size() - 1);
+  size_--;
+  return work;
+}
+
 ThreadPool::ThreadPool(size_t threadPoolSize)
-    : shutdown_(false), appDomainContext_(createAppDomainContext()) {
+    : shutdown_(false),
+      queues_(new WorkQueue[threadPoolSize > 0 ? threadPoolSize : 1]),
+      queueCount_(threadPoolSize > 0 ? threadPoolSize : 1),
+      nextQueue_(0),
+      pending_(0),
+      sleeping_(0),
+      appDomainContext_(createAppDomainContext()) {
   workers_.reserve(threadPoolSize);
 
-  std::function<void()> executeWork = [this] {
-    DistributedSystemImpl::setThreadName(NC_Pool_Thread);
-    while (true) {
-      std::unique_lock<decltype(queueMutex_)> lock(queueMutex_);
-      queueCondition_.wait(lock,
-                           [this] { return shutdown_ || !queue_.empty(); });
+  for (size_t i = 0; i < threadPoolSize; i++) {
+    std::function<void()> executeWork = [this, i] { this->executeWork(i); };
+    if (appDomainContext_) {
+      executeWork = [executeWork, this] {
+        appDomainContext_->run(executeWork);
+      };
+    }
+    workers_.emplace_back(executeWork);
+  }
+}
 
-      if (shutdown_) {
-        break;
-      }
+ThreadPool::~ThreadPool() { shutDown(); }
 
-      auto work = queue_.front();
-      queue_.pop_front();
+void ThreadPool::perform(std::shared_ptr<Callable> req) {
+  auto index = currentPool == this
+                   ? currentQueue
+                   : nextQueue_.fetch_add(1, std::memory_order_relaxed) %
+                         queueCount_;
+
+  // pairs with executeWork, either the sleeping thread sees the pending work
+  // or this thread sees it sleeping. Threads woken for earlier work wake
+  // further threads while there is more.
+  auto idle = pending_.fetch_add(1) == 0;
+  queues_[index].push(std::move(req));
+  if (idle) {
+    wakeOne();
+  }
+}
 
-      lock.unlock();
+void ThreadPool::wakeOne() {
+  if (sleeping_.load() > 0) {
+    std::lock_guard<decltype(sleepMutex_)> lock(sleepMutex_);
+    sleepCondition_.notify_one();
+  }
+}
 
+void ThreadPool::executeWork(size_t index) {
+  DistributedSystemImpl::setThreadName(NC_Pool_Thread);
+  currentPool = this;
+  currentQueue = index;
+
+  while (!shutdown_) {
+    if (auto work = take(index)) {
       try {
         work->call();
       } catch (...) {
         // ignore
       }
+      continue;
     }
-  };
 
-  if (appDomainContext_) {
-    executeWork = [executeWork, this] { appDomainContext_->run(executeWork); };
+    std::unique_lock<decltype(sleepMutex_)> lock(sleepMutex_);
+    ++sleeping_;
+    sleepCondition_.wait(lock, [this] { return shutdown_ || pending_ > 0; });
+    --sleeping_;
   }
 
-  for (size_t i = 0; i < threadPoolSize; i++) {
-    workers_.emplace_back(executeWork);
-  }
+  currentPool = nullptr;
 }
 
-ThreadPool::~ThreadPool() { shutDown(); }
+std::shared_ptr<Callable> ThreadPool::take(size_t index) {
+  if (pending_ == 0) {
+    return nullptr;
+  }
 
-void ThreadPool::perform(std::shared_ptr<Callable> req) {
-  {
-    std::lock_guard<decltype(queueMutex_)> lock(queueMutex_);
-    queue_.push_back(std::move(req));
-    if (queue_.size() > 1) {
-      return;
-    }
+  auto work = queues_[index].popNewest();
+  for (size_t i = 1; !work && i < queueCount_; i++) {
+    work = queues_[(index + i) % queueCount_].popOldest();
   }
 
-  queueCondition_.notify_all();
+  if (work && pending_.fetch_sub(1) > 1) {
+    wakeOne();
+  }
+  return work;
 }
 
 void ThreadPool::shutDown(void) {
   {
-    std::lock_guard<decltype(queueMutex_)> lock(queueMutex_);
+    std::lock_guard<decltype(sleepMutex_)> lock(sleepMutex_);
     if (shutdown_) {
       return;
     }
     shutdown_ = true;
   }
 
-  queueCondition_.notify_all();
+  sleepCondition_.notify_all();
 
   for (auto& worker : workers_) {
     worker.join();
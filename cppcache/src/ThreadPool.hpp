@@ -22,7 +22,7 @@
 
 #include <atomic>
 #include <condition_variable>
-#include <deque>
+#include <memory>
 #include <mutex>
 #include <thread>
 #include <vector>
@@ -39,20 +39,34 @@ class Callable {
   virtual void call() = 0;
 };
 
+/**
+ * Whether the calling thread is a thread of any ThreadPool.
+ */
+bool isPoolThread();
+
+/**
+ * Work whose result is waited for by the thread that submitted it.
+ *
+ * If no pool thread has started the work by the time a pool thread calls
+ * getResult, that thread runs it itself, so nested fan-out from pool threads
+ * can not starve the pool. Application threads always wait, as work run on
+ * them would see their transaction, connection and user thread locals.
+ */
 template <class T>
 class PooledWork : public Callable {
  private:
   T m_retVal;
-  std::recursive_mutex m_mutex;
-  std::condition_variable_any m_cond;
+  std::atomic<bool> m_claimed;
+  std::mutex m_mutex;
+  std::condition_variable m_cond;
   bool m_done;
 
- public:
-  PooledWork() : m_mutex(), m_cond(), m_done(false) {}
-
-  ~PooledWork() override {}
+  bool claim() {
+    return !m_claimed.load(std::memory_order_relaxed) &&
+           !m_claimed.exchange(true, std::memory_order_acquire);
+  }
 
-  void call() override {
+  void run() {
     T res = execute();
 
     std::lock_guard<decltype(m_mutex)> lock(m_mutex);
@@ -62,20 +76,57 @@ class PooledWork : public Callable {
     m_cond.notify_all();
   }
 
-  T getResult(void) {
+  T waitForResult() {
     std::unique_lock<decltype(m_mutex)> lock(m_mutex);
+    m_cond.wait(lock, [this] { return m_done; });
 
-    while (!m_done) {
-      m_cond.wait(lock, [this] { return m_done; });
+    return m_retVal;
+  }
+
+ public:
+  PooledWork() : m_claimed(false), m_mutex(), m_cond(), m_done(false) {}
+
+  ~PooledWork() override {}
+
+  void call() override {
+    if (claim()) {
+      run();
     }
+  }
 
-    return m_retVal;
+  T getResult(void) {
+    if (isPoolThread() && claim()) {
+      run();
+    }
+
+    return waitForResult();
+  }
+
+  /**
+   * Like getResult, but runs the work on the calling thread whichever thread
+   * it is, so only for work that does not depend on the thread locals of the
+   * thread running it.
+   */
+  T runOrGetResult(void) {
+    if (claim()) {
+      run();
+    }
+
+    return waitForResult();
   }
 
  protected:
   virtual T execute(void) = 0;
 };
 
+/**
+ * Fixed size pool of threads, each with its own queue of work.
+ *
+ * Work performed by a pool thread goes to that thread's queue, which it
+ * works off newest first. Work performed by any other thread is spread
+ * round robin over the pool threads' queues. Idle pool threads steal the
+ * oldest work from the other queues before going to sleep.
+ */
 class ThreadPool {
  public:
   explicit ThreadPool(size_t threadPoolSize);
@@ -86,13 +137,45 @@ class ThreadPool {
   void shutDown(void);
 
  private:
-  bool shutdown_;
+  /**
+   * Double ended ring buffer of work. Its size is a power of two and it
+   * only grows, so submitting work does not allocate once the buffer is
+   * large enough.
+   */
+  class WorkQueue {
+   public:
+    WorkQueue() : head_(0), size_(0), buffer_(16) {}
+
+    void push(std::shared_ptr<Callable>&& work);
+
+    std::shared_ptr<Callable> popNewest();
+
+    std::shared_ptr<Callable> popOldest();
+
+   private:
+    std::mutex mutex_;
+    size_t head_;
+    size_t size_;
+    std::vector<std::shared_ptr<Callable>> buffer_;
+  };
+
+  std::atomic<bool> shutdown_;
   std::vector<std::thread> workers_;
-  std::deque<std::shared_ptr<Callable>> queue_;
-  std::mutex queueMutex_;
-  std::condition_variable queueCondition_;
+  std::unique_ptr<WorkQueue[]> queues_;
+  size_t queueCount_;
+  std::atomic<size_t> nextQueue_;
+  std::atomic<size_t> pending_;
+  std::atomic<size_t> sleeping_;
+  std::mutex sleepMutex_;
+  std::condition_variable sleepCondition_;
   static const char* NC_Pool_Thread;
   AppDomainContext* appDomainContext_;
+
+  void executeWork(size_t index);
+
+  void wakeOne();
+
+  std::shared_ptr<Callable> take(size_t index);
 };
 
 }  // namespace client
@@ -110,12 +110,16 @@ AuthenticatedView* UserAttributes::getAuthenticatedView() {
 thread_local std::shared_ptr<UserAttributes>
     UserAttributes::threadLocalUserAttributes;
 
-GuardUserAttributes::GuardUserAttributes(AuthenticatedView* authenticatedView) {
+GuardUserAttributes::GuardUserAttributes(AuthenticatedView* authenticatedView)
+    : m_authenticatedView(nullptr) {
   setAuthenticatedView(authenticatedView);
 }
 
 void GuardUserAttributes::setAuthenticatedView(
     AuthenticatedView* authenticatedView) {
+  if (m_authenticatedView == nullptr) {
+    m_previousUserAttributes = UserAttributes::threadLocalUserAttributes;
+  }
   m_authenticatedView = authenticatedView;
   LOGDEBUG("GuardUserAttributes::GuardUserAttributes:");
   if (m_authenticatedView != nullptr && !authenticatedView->isClosed()) {
@@ -129,8 +133,10 @@ void GuardUserAttributes::setAuthenticatedView(
 GuardUserAttributes::GuardUserAttributes() { m_authenticatedView = nullptr; }
 
 GuardUserAttributes::~GuardUserAttributes() {
+  // pooled work may run on the thread that submitted it, restore that
+  // thread's own user
   if (m_authenticatedView != nullptr) {
-    UserAttributes::threadLocalUserAttributes = nullptr;
+    UserAttributes::threadLocalUserAttributes = m_previousUserAttributes;
   }
 }
 
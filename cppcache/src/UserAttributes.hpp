@@ -135,6 +135,7 @@ class GuardUserAttributes {
 
  private:
   AuthenticatedView* m_authenticatedView;
+  std::shared_ptr<UserAttributes> m_previousUserAttributes;
 };
 
 }  // namespace client
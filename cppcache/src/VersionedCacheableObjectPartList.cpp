@@ -277,7 +277,7 @@ void VersionedCacheableObjectPartList::fromData(DataInput& input) {
                   already contains an entry with higher version.",
                 Utils::nullSafeToString(key).c_str());
             // replace the value with higher version tag
-            (*m_values)[key] = oldValue;
+            (*m_values)[key] = m_region->loadValue(oldValue);
           }
         }       // END::m_addToLocalCache
         else {  // m_addToLocalCache = false
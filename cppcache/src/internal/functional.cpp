@@ -0,0 +1,244 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <geode/internal/functional.hpp>
+
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSE4_1__)
+#include <smmintrin.h>
+#define GEODE_FUNCTIONAL_SSE2
+#elif defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define GEODE_FUNCTIONAL_SSE2
+#endif
+
+namespace apache {
+namespace geode {
+namespace client {
+namespace internal {
+
+namespace {
+
+/*
+ * java.lang.String hashes code units c[0..n) as the sum of c[i] * 31^(n-1-i).
+ * Rather than one multiply per code unit, runs of code units are hashed in
+ * blocks of BLOCK_SIZE, each lane accumulating every BLOCK_SIZE-th code unit
+ * scaled by 31^BLOCK_SIZE. The lanes are weighted by the remaining powers of
+ * 31 and summed once at the end of the run.
+ */
+const size_t BLOCK_SIZE = 16;
+
+const uint32_t POW31[BLOCK_SIZE + 1] = {
+    1u,          31u,         961u,        29791u,      923521u,
+    28629151u,   887503681u,  1742810335u, 2487512833u, 4098453791u,
+    2498015937u, 129082719u,  4001564289u, 3789408671u, 1507551809u,
+    3784433119u, 1353309697u};
+
+const uint64_t HIGH_BITS = 0x8080808080808080ULL;
+
+#if defined(GEODE_FUNCTIONAL_SSE2)
+
+inline __m128i mullo32(__m128i a, __m128i b) {
+#if defined(__SSE4_1__)
+  return _mm_mullo_epi32(a, b);
+#else
+  const auto even = _mm_mul_epu32(a, b);
+  const auto odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+  return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+                            _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+#endif
+}
+
+inline __m128i set(const uint32_t* values) {
+  return _mm_loadu_si128(reinterpret_cast<const __m128i*>(values));
+}
+
+struct Lanes {
+  __m128i v[4];
+};
+
+inline Lanes load(const char16_t* units) {
+  const auto zero = _mm_setzero_si128();
+  const auto low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(units));
+  const auto high =
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(units + 8));
+  return {{_mm_unpacklo_epi16(low, zero), _mm_unpackhi_epi16(low, zero),
+           _mm_unpacklo_epi16(high, zero), _mm_unpackhi_epi16(high, zero)}};
+}
+
+inline Lanes load(const uint8_t* ascii) {
+  const auto zero = _mm_setzero_si128();
+  const auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ascii));
+  const auto low = _mm_unpacklo_epi8(v, zero);
+  const auto high = _mm_unpackhi_epi8(v, zero);
+  return {{_mm_unpacklo_epi16(low, zero), _mm_unpackhi_epi16(low, zero),
+           _mm_unpacklo_epi16(high, zero), _mm_unpackhi_epi16(high, zero)}};
+}
+
+inline uint32_t sum(__m128i v) {
+  v = _mm_add_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2)));
+  v = _mm_add_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1)));
+  return static_cast<uint32_t>(_mm_cvtsi128_si32(v));
+}
+
+/**
+ * Continues <code>hash</code> over <code>blocks</code> blocks of code units.
+ */
+template <class CharT>
+uint32_t hashBlocks(uint32_t hash, const CharT* units, size_t blocks) {
+  // weights of the lanes in reverse order of the code units
+  static const uint32_t weights[BLOCK_SIZE] = {
+      POW31[15], POW31[14], POW31[13], POW31[12], POW31[11], POW31[10],
+      POW31[9],  POW31[8],  POW31[7],  POW31[6],  POW31[5],  POW31[4],
+      POW31[3],  POW31[2],  POW31[1],  POW31[0]};
+
+  const auto scale = _mm_set1_epi32(static_cast<int32_t>(POW31[BLOCK_SIZE]));
+  Lanes lanes = {{_mm_setzero_si128(), _mm_setzero_si128(),
+                  _mm_setzero_si128(), _mm_setzero_si128()}};
+  uint32_t hashScale = 1;
+  for (; blocks > 0; --blocks, units += BLOCK_SIZE) {
+    const auto block = load(units);
+    for (size_t i = 0; i < 4; ++i) {
+      lanes.v[i] = _mm_add_epi32(mullo32(lanes.v[i], scale), block.v[i]);
+    }
+    hashScale *= POW31[BLOCK_SIZE];
+  }
+
+  auto weighted = _mm_setzero_si128();
+  for (size_t i = 0; i < 4; ++i) {
+    weighted =
+        _mm_add_epi32(weighted, mullo32(lanes.v[i], set(weights + i * 4)));
+  }
+  return hash * hashScale + sum(weighted);
+}
+
+#else
+
+template <class CharT>
+uint32_t hashBlocks(uint32_t hash, const CharT* units, size_t blocks) {
+  uint32_t lanes[BLOCK_SIZE] = {};
+  uint32_t hashScale = 1;
+  for (; blocks > 0; --blocks, units += BLOCK_SIZE) {
+    for (size_t i = 0; i < BLOCK_SIZE; ++i) {
+      lanes[i] = lanes[i] * POW31[BLOCK_SIZE] + units[i];
+    }
+    hashScale *= POW31[BLOCK_SIZE];
+  }
+
+  hash *= hashScale;
+  for (size_t i = 0; i < BLOCK_SIZE; ++i) {
+    hash += lanes[i] * POW31[BLOCK_SIZE - 1 - i];
+  }
+  return hash;
+}
+
+#endif
+
+/**
+ * Length of the leading run of ASCII bytes in [begin, end).
+ */
+size_t asciiLength(const uint8_t* begin, const uint8_t* end) {
+  auto p = begin;
+  for (; end - p >= static_cast<ptrdiff_t>(sizeof(uint64_t));
+       p += sizeof(uint64_t)) {
+    uint64_t word;
+    std::memcpy(&word, p, sizeof(word));
+    if (word & HIGH_BITS) {
+      break;
+    }
+  }
+  while (p < end && *p < 0x80) {
+    ++p;
+  }
+  return static_cast<size_t>(p - begin);
+}
+
+/**
+ * Continues <code>hash</code> over <code>length</code> code units.
+ */
+template <class CharT>
+uint32_t hashUnits(uint32_t hash, const CharT* units, size_t length) {
+  const auto blocks = length / BLOCK_SIZE;
+  if (blocks > 0) {
+    hash = hashBlocks(hash, units, blocks);
+  }
+  const auto end = units + length;
+  for (units += blocks * BLOCK_SIZE; units < end; ++units) {
+    hash = 31 * hash + *units;
+  }
+  return hash;
+}
+
+}  // namespace
+
+int32_t geode_hash<std::u16string>::operator()(const std::u16string& val) {
+  return static_cast<int32_t>(hashUnits(0, val.data(), val.length()));
+}
+
+int32_t geode_hash<std::string>::operator()(const std::string& val) {
+  uint32_t hash = 0;
+
+  auto it = reinterpret_cast<const uint8_t*>(val.data());
+  const auto end = it + val.length();
+  while (it < end) {
+    uint32_t cp = *it;
+    const auto remaining = end - it;
+    if (cp < 0x80) {
+      // ASCII bytes are also UTF-16 code units
+      const auto ascii = asciiLength(it, end);
+      hash = hashUnits(hash, it, ascii);
+      it += ascii;
+      continue;
+    } else if ((cp >> 5) == 0x6 && remaining >= 2) {
+      // 2 bytes
+      cp = ((cp << 6) & 0x7ff) + (it[1] & 0x3f);
+      it += 2;
+    } else if ((cp >> 4) == 0xe && remaining >= 3) {
+      // 3 bytes
+      cp = ((cp << 12) & 0xffff) + ((it[1] << 6) & 0xfff) + (it[2] & 0x3f);
+      it += 3;
+    } else if ((cp >> 3) == 0x1e && remaining >= 4) {
+      // 4 bytes
+      cp = ((cp << 18) & 0x1fffff) + ((it[1] << 12) & 0x3ffff) +
+           ((it[2] << 6) & 0xfff) + (it[3] & 0x3f);
+      it += 4;
+    } else {
+      // TODO throw exception
+      ++it;
+    }
+
+    if (cp > 0xffff) {
+      // surrogate pair
+      hash = 31 * hash +
+             static_cast<uint16_t>((cp >> 10) + (0xD800 - (0x10000 >> 10)));
+      hash = 31 * hash + static_cast<uint16_t>((cp & 0x3ff) + 0xdc00u);
+    } else {
+      // single code unit
+      hash = 31 * hash + cp;
+    }
+  }
+
+  return static_cast<int32_t>(hash);
+}
+
+}  // namespace internal
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
@@ -17,21 +17,411 @@
 
 #include "JavaModifiedUtf8.hpp"
 
-#include <codecvt>
-#include <locale>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
 
-#include "string.hpp"
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define GEODE_JAVAMODIFIEDUTF8_AVX2
+#define GEODE_JAVAMODIFIEDUTF8_SSE2
+#elif defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define GEODE_JAVAMODIFIEDUTF8_SSE2
+#endif
 
 namespace apache {
 namespace geode {
 namespace client {
 namespace internal {
-size_t JavaModifiedUtf8::encodedLength(const std::string& utf8) {
-  if (utf8.empty()) {
-    return 0;
+
+namespace {
+
+const uint64_t HIGH_BITS = 0x8080808080808080ULL;
+const uint64_t LOW_BITS = 0x0101010101010101ULL;
+
+/**
+ * Length of the leading run of ASCII bytes in [begin, end). Unless AllowNul,
+ * the run also ends at NUL, which Java Modified UTF-8 encodes in two bytes.
+ */
+template <bool AllowNul>
+size_t asciiLength(const uint8_t* begin, const uint8_t* end) {
+  auto p = begin;
+
+#if defined(GEODE_JAVAMODIFIEDUTF8_AVX2)
+  const auto zero256 = _mm256_setzero_si256();
+  for (; end - p >= 32; p += 32) {
+    const auto v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    auto mask = _mm256_movemask_epi8(v);
+    if (!AllowNul) {
+      mask |= _mm256_movemask_epi8(_mm256_cmpeq_epi8(v, zero256));
+    }
+    if (mask) {
+      break;
+    }
+  }
+#endif
+
+#if defined(GEODE_JAVAMODIFIEDUTF8_SSE2)
+  const auto zero = _mm_setzero_si128();
+  for (; end - p >= 16; p += 16) {
+    const auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    auto mask = _mm_movemask_epi8(v);
+    if (!AllowNul) {
+      mask |= _mm_movemask_epi8(_mm_cmpeq_epi8(v, zero));
+    }
+    if (mask) {
+      break;
+    }
+  }
+#endif
+
+  for (; end - p >= 8; p += 8) {
+    uint64_t word;
+    std::memcpy(&word, p, sizeof(word));
+    auto mask = word & HIGH_BITS;
+    if (!AllowNul) {
+      // sets the high bit of at least the first NUL byte
+      mask |= (word - LOW_BITS) & ~word & HIGH_BITS;
+    }
+    if (mask) {
+      break;
+    }
+  }
+
+  while (p < end && *p < 0x80 && (AllowNul || *p != 0)) {
+    ++p;
+  }
+  return static_cast<size_t>(p - begin);
+}
+
+/**
+ * Length of the leading run of UTF-16 code units in [begin, end) that encode
+ * to a single byte.
+ */
+size_t asciiLength(const char16_t* begin, const char16_t* end) {
+  auto p = begin;
+
+#if defined(GEODE_JAVAMODIFIEDUTF8_SSE2)
+  const auto zero = _mm_setzero_si128();
+  const auto nonAsciiBits = _mm_set1_epi16(static_cast<int16_t>(0xff80));
+  for (; end - p >= 8; p += 8) {
+    const auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    const auto ascii = _mm_cmpeq_epi16(_mm_and_si128(v, nonAsciiBits), zero);
+    const auto nul = _mm_cmpeq_epi16(v, zero);
+    if (_mm_movemask_epi8(_mm_andnot_si128(nul, ascii)) != 0xffff) {
+      break;
+    }
+  }
+#endif
+
+  while (p < end && *p < 0x80 && *p != 0) {
+    ++p;
+  }
+  return static_cast<size_t>(p - begin);
+}
+
+/**
+ * Narrows the leading run of at most <code>n</code> UTF-16 code units that
+ * encode to a single byte into <code>out</code>.
+ */
+size_t copyAscii(const char16_t* in, size_t n, char* out) {
+  size_t i = 0;
+
+#if defined(GEODE_JAVAMODIFIEDUTF8_SSE2)
+  const auto zero = _mm_setzero_si128();
+  const auto nonAsciiBits = _mm_set1_epi16(static_cast<int16_t>(0xff80));
+  for (; i + 8 <= n; i += 8) {
+    const auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+    const auto ascii = _mm_cmpeq_epi16(_mm_and_si128(v, nonAsciiBits), zero);
+    const auto nul = _mm_cmpeq_epi16(v, zero);
+    if (_mm_movemask_epi8(_mm_andnot_si128(nul, ascii)) != 0xffff) {
+      break;
+    }
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(out + i),
+                     _mm_packus_epi16(v, v));
+  }
+#endif
+
+  for (; i < n && in[i] < 0x80 && in[i] != 0; ++i) {
+    out[i] = static_cast<char>(in[i]);
+  }
+  return i;
+}
+
+/**
+ * Narrows the leading run of at most <code>n</code> UCS-4 code points that
+ * encode to a single byte into <code>out</code>.
+ */
+size_t copyAscii(const char32_t* in, size_t n, char* out) {
+  size_t i = 0;
+
+#if defined(GEODE_JAVAMODIFIEDUTF8_SSE2)
+  const auto zero = _mm_setzero_si128();
+  const auto nonAsciiBits = _mm_set1_epi32(static_cast<int32_t>(0xffffff80));
+  for (; i + 8 <= n; i += 8) {
+    const auto lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+    const auto hi =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i + 4));
+    const auto ascii =
+        _mm_and_si128(_mm_cmpeq_epi32(_mm_and_si128(lo, nonAsciiBits), zero),
+                      _mm_cmpeq_epi32(_mm_and_si128(hi, nonAsciiBits), zero));
+    const auto nul =
+        _mm_or_si128(_mm_cmpeq_epi32(lo, zero), _mm_cmpeq_epi32(hi, zero));
+    if (_mm_movemask_epi8(_mm_andnot_si128(nul, ascii)) != 0xffff) {
+      break;
+    }
+    const auto packed = _mm_packs_epi32(lo, hi);
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(out + i),
+                     _mm_packus_epi16(packed, packed));
+  }
+#endif
+
+  for (; i < n && in[i] < 0x80 && in[i] != 0; ++i) {
+    out[i] = static_cast<char>(in[i]);
+  }
+  return i;
+}
+
+/**
+ * Widens the leading run of at most <code>n</code> ASCII bytes into
+ * <code>out</code>.
+ */
+size_t copyAscii(const uint8_t* in, size_t n, char16_t* out) {
+  size_t i = 0;
+
+#if defined(GEODE_JAVAMODIFIEDUTF8_SSE2)
+  const auto zero = _mm_setzero_si128();
+  for (; i + 16 <= n; i += 16) {
+    const auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+    if (_mm_movemask_epi8(v)) {
+      break;
+    }
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i),
+                     _mm_unpacklo_epi8(v, zero));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i + 8),
+                     _mm_unpackhi_epi8(v, zero));
+  }
+#endif
+
+  for (; i < n && in[i] < 0x80; ++i) {
+    out[i] = in[i];
+  }
+  return i;
+}
+
+/**
+ * Widens the leading run of at most <code>n</code> ASCII bytes into
+ * <code>out</code>.
+ */
+size_t copyAscii(const uint8_t* in, size_t n, char32_t* out) {
+  size_t i = 0;
+
+#if defined(GEODE_JAVAMODIFIEDUTF8_SSE2)
+  const auto zero = _mm_setzero_si128();
+  for (; i + 16 <= n; i += 16) {
+    const auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+    if (_mm_movemask_epi8(v)) {
+      break;
+    }
+    const auto lo = _mm_unpacklo_epi8(v, zero);
+    const auto hi = _mm_unpackhi_epi8(v, zero);
+    auto p = reinterpret_cast<__m128i*>(out + i);
+    _mm_storeu_si128(p, _mm_unpacklo_epi16(lo, zero));
+    _mm_storeu_si128(p + 1, _mm_unpackhi_epi16(lo, zero));
+    _mm_storeu_si128(p + 2, _mm_unpacklo_epi16(hi, zero));
+    _mm_storeu_si128(p + 3, _mm_unpackhi_epi16(hi, zero));
+  }
+#endif
+
+  for (; i < n && in[i] < 0x80; ++i) {
+    out[i] = in[i];
+  }
+  return i;
+}
+
+void checkCodePoint(char32_t c) {
+  if (c > 0x10ffff) {
+    throw std::range_error("Invalid Unicode code point.");
+  }
+}
+
+/**
+ * Decodes the UTF-8 sequence at <code>p</code> and advances past it.
+ */
+char32_t decodeUtf8(const uint8_t*& p, const uint8_t* end) {
+  const uint8_t b = *(p++);
+  if (b < 0x80) {
+    return b;
+  }
+
+  ptrdiff_t trailing;
+  char32_t c;
+  if (b < 0xc0) {
+    throw std::range_error("Unexpected UTF-8 continuation byte.");
+  } else if (b < 0xe0) {
+    trailing = 1;
+    c = b & 0x1f;
+  } else if (b < 0xf0) {
+    trailing = 2;
+    c = b & 0x0f;
+  } else if (b < 0xf8) {
+    trailing = 3;
+    c = b & 0x07;
+  } else {
+    throw std::range_error("Invalid UTF-8 lead byte.");
+  }
+
+  if (end - p < trailing) {
+    throw std::range_error("Truncated UTF-8 sequence.");
+  }
+  for (; trailing > 0; --trailing) {
+    if ((*p & 0xc0) != 0x80) {
+      throw std::range_error("Missing UTF-8 continuation byte.");
+    }
+    c = (c << 6) | (*(p++) & 0x3f);
+  }
+
+  checkCodePoint(c);
+  return c;
+}
+
+size_t codePointEncodedLength(char32_t c) {
+  if (c == 0) {
+    // NUL
+    return 2;
+  } else if (c < 0x80) {
+    // ASCII
+    return 1;
+  } else if (c < 0x800) {
+    return 2;
+  } else if (c < 0x10000) {
+    return 3;
+  } else {
+    // surrogate pair
+    return 6;
+  }
+}
+
+char* encodeUnit(char16_t c, char* out) {
+  if (c == 0) {
+    // NUL
+    *(out++) = static_cast<char>(0xc0);
+    *(out++) = static_cast<char>(0x80);
+  } else if (c < 0x80) {
+    // ASCII character
+    *(out++) = static_cast<char>(c);
+  } else if (c < 0x800) {
+    *(out++) = static_cast<char>(0xC0 | c >> 6);
+    *(out++) = static_cast<char>(0x80 | (c & 0x3F));
+  } else {
+    *(out++) = static_cast<char>(0xE0 | c >> 12);
+    *(out++) = static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+    *(out++) = static_cast<char>(0x80 | (c & 0x3F));
+  }
+  return out;
+}
+
+char* encodeCodePoint(char32_t c, char* out) {
+  if (c < 0x10000) {
+    return encodeUnit(static_cast<char16_t>(c), out);
+  }
+
+  c -= 0x10000;
+  out = encodeUnit(static_cast<char16_t>(0xd800 | (c >> 10)), out);
+  return encodeUnit(static_cast<char16_t>(0xdc00 | (c & 0x3ff)), out);
+}
+
+/**
+ * Decodes the Java Modified UTF-8 sequence for a single UTF-16 code unit at
+ * <code>p</code> and advances past it. Continuation bytes are not checked.
+ */
+char16_t decodeUnit(const uint8_t*& p, const uint8_t* end) {
+  const uint8_t b = *(p++);
+  switch (b >> 5) {
+    case 6:
+      // 110yyyyy 10xxxxxx
+      if (p < end) {
+        const char16_t y = b & 0x1f;
+        const char16_t x = *(p++) & 0x3f;
+        return static_cast<char16_t>(y << 6 | x);
+      }
+      break;
+    case 7:
+      // 1110zzzz 10yyyyyy 10xxxxxx
+      if (end - p >= 2) {
+        const char16_t z = b & 0x0f;
+        const char16_t y = *(p++) & 0x3f;
+        const char16_t x = *(p++) & 0x3f;
+        return static_cast<char16_t>(z << 12 | y << 6 | x);
+      }
+      break;
+    default:
+      // 0xxxxxxx
+      return static_cast<char16_t>(b & 0x7f);
   }
 
-  return encodedLength(to_utf16(utf8));
+  // sequence cut short by the end of the buffer
+  p = end;
+  return u'\ufffd';
+}
+
+/**
+ * Like decodeUnit but combines a surrogate pair into a single code point.
+ */
+char32_t decodeCodePoint(const uint8_t*& p, const uint8_t* end) {
+  const char32_t c = decodeUnit(p, end);
+  if (c >= 0xd800 && c < 0xdc00 && p < end) {
+    auto next = p;
+    const char32_t low = decodeUnit(next, end);
+    if (low >= 0xdc00 && low < 0xe000) {
+      p = next;
+      return 0x10000 + ((c - 0xd800) << 10) + (low - 0xdc00);
+    }
+  }
+  return c;
+}
+
+void appendUtf8(char32_t c, std::string& utf8) {
+  if (c < 0x80) {
+    utf8 += static_cast<char>(c);
+  } else if (c < 0x800) {
+    utf8 += static_cast<char>(0xc0 | c >> 6);
+    utf8 += static_cast<char>(0x80 | (c & 0x3f));
+  } else if (c < 0x10000) {
+    utf8 += static_cast<char>(0xe0 | c >> 12);
+    utf8 += static_cast<char>(0x80 | ((c >> 6) & 0x3f));
+    utf8 += static_cast<char>(0x80 | (c & 0x3f));
+  } else {
+    utf8 += static_cast<char>(0xf0 | c >> 18);
+    utf8 += static_cast<char>(0x80 | ((c >> 12) & 0x3f));
+    utf8 += static_cast<char>(0x80 | ((c >> 6) & 0x3f));
+    utf8 += static_cast<char>(0x80 | (c & 0x3f));
+  }
+}
+
+}  // namespace
+
+size_t JavaModifiedUtf8::encodedLength(const std::string& utf8) {
+  return encodedLength(utf8.data(), utf8.length());
+}
+
+size_t JavaModifiedUtf8::encodedLength(const char* utf8, size_t length) {
+  auto p = reinterpret_cast<const uint8_t*>(utf8);
+  const auto end = p + length;
+  size_t encodedLen = 0;
+  while (p < end) {
+    if (*p < 0x80 && *p != 0) {
+      const auto ascii = asciiLength<false>(p, end);
+      encodedLen += ascii;
+      p += ascii;
+    } else {
+      encodedLen += codePointEncodedLength(decodeUtf8(p, end));
+    }
+  }
+  return encodedLen;
 }
 
 size_t JavaModifiedUtf8::encodedLength(const std::u16string& utf16) {
@@ -39,66 +429,197 @@ size_t JavaModifiedUtf8::encodedLength(const std::u16string& utf16) {
 }
 
 size_t JavaModifiedUtf8::encodedLength(const char16_t* data, size_t length) {
+  const auto end = data + length;
   size_t encodedLen = 0;
-  while (length-- > 0) {
-    const char16_t c = *(data++);
-    if (c == 0) {
-      // NUL
-      encodedLen += 2;
-    } else if (c < 0x80) {
-      // ASCII
-      encodedLen++;
-    } else if (c < 0x800) {
-      encodedLen += 2;
+  while (data < end) {
+    if (*data < 0x80 && *data != 0) {
+      const auto ascii = asciiLength(data, end);
+      encodedLen += ascii;
+      data += ascii;
     } else {
-      encodedLen += 3;
+      encodedLen += codePointEncodedLength(*(data++));
     }
   }
   return encodedLen;
 }
 
+size_t JavaModifiedUtf8::encodedLength(const char32_t* ucs4, size_t length) {
+  size_t encodedLen = 0;
+  while (length-- > 0) {
+    const char32_t c = *(ucs4++);
+    checkCodePoint(c);
+    encodedLen += codePointEncodedLength(c);
+  }
+  return encodedLen;
+}
+
 std::string JavaModifiedUtf8::fromString(const std::string& utf8) {
-  return fromString(to_utf16(utf8));
+  std::string jmutf8(encodedLength(utf8), '\0');
+  encode(utf8.data(), utf8.length(), &jmutf8[0], jmutf8.length());
+  return jmutf8;
 }
 
 std::string JavaModifiedUtf8::fromString(const std::u16string& utf16) {
-  std::string jmutf8;
-  jmutf8.reserve(utf16.length());
+  std::string jmutf8(encodedLength(utf16), '\0');
+  encode(utf16.data(), utf16.length(), &jmutf8[0], jmutf8.length());
+  return jmutf8;
+}
 
-  for (auto&& c : utf16) {
-    encode(c, jmutf8);
+size_t JavaModifiedUtf8::encode(const char* utf8, size_t length, char* jmutf8,
+                                size_t capacity) {
+  auto p = reinterpret_cast<const uint8_t*>(utf8);
+  const auto end = p + length;
+  auto out = jmutf8;
+  const auto outEnd = jmutf8 + capacity;
+  while (p < end) {
+    if (*p < 0x80 && *p != 0) {
+      const auto ascii = std::min<size_t>(asciiLength<false>(p, end),
+                                          static_cast<size_t>(outEnd - out));
+      if (ascii == 0) {
+        break;
+      }
+      std::memcpy(out, p, ascii);
+      p += ascii;
+      out += ascii;
+    } else {
+      auto next = p;
+      const auto c = decodeUtf8(next, end);
+      if (static_cast<size_t>(outEnd - out) < codePointEncodedLength(c)) {
+        break;
+      }
+      out = encodeCodePoint(c, out);
+      p = next;
+    }
   }
+  return static_cast<size_t>(out - jmutf8);
+}
 
-  return jmutf8;
+size_t JavaModifiedUtf8::encode(const char16_t* utf16, size_t length,
+                                char* jmutf8, size_t capacity) {
+  const auto end = utf16 + length;
+  auto out = jmutf8;
+  const auto outEnd = jmutf8 + capacity;
+  while (utf16 < end) {
+    const auto c = *utf16;
+    if (c < 0x80 && c != 0) {
+      const auto ascii = copyAscii(
+          utf16,
+          std::min<size_t>(static_cast<size_t>(end - utf16),
+                           static_cast<size_t>(outEnd - out)),
+          out);
+      if (ascii == 0) {
+        break;
+      }
+      utf16 += ascii;
+      out += ascii;
+    } else {
+      if (static_cast<size_t>(outEnd - out) < codePointEncodedLength(c)) {
+        break;
+      }
+      out = encodeUnit(c, out);
+      ++utf16;
+    }
+  }
+  return static_cast<size_t>(out - jmutf8);
 }
 
-void JavaModifiedUtf8::encode(const char16_t c, std::string& jmutf8) {
-  if (c == 0) {
-    // NUL
-    jmutf8 += static_cast<uint8_t>(0xc0);
-    jmutf8 += static_cast<uint8_t>(0x80);
-  } else if (c < 0x80) {
-    // ASCII character
-    jmutf8 += static_cast<uint8_t>(c);
-  } else if (c < 0x800) {
-    jmutf8 += static_cast<uint8_t>(0xC0 | c >> 6);
-    jmutf8 += static_cast<uint8_t>(0x80 | (c & 0x3F));
-  } else {
-    jmutf8 += static_cast<uint8_t>(0xE0 | c >> 12);
-    jmutf8 += static_cast<uint8_t>(0x80 | ((c >> 6) & 0x3F));
-    jmutf8 += static_cast<uint8_t>(0x80 | (c & 0x3F));
+size_t JavaModifiedUtf8::encode(const char32_t* ucs4, size_t length,
+                                char* jmutf8, size_t capacity) {
+  const auto end = ucs4 + length;
+  auto out = jmutf8;
+  const auto outEnd = jmutf8 + capacity;
+  while (ucs4 < end) {
+    const auto c = *ucs4;
+    if (c < 0x80 && c != 0) {
+      const auto ascii = copyAscii(
+          ucs4,
+          std::min<size_t>(static_cast<size_t>(end - ucs4),
+                           static_cast<size_t>(outEnd - out)),
+          out);
+      if (ascii == 0) {
+        break;
+      }
+      ucs4 += ascii;
+      out += ascii;
+    } else {
+      checkCodePoint(c);
+      if (static_cast<size_t>(outEnd - out) < codePointEncodedLength(c)) {
+        break;
+      }
+      out = encodeCodePoint(c, out);
+      ++ucs4;
+    }
   }
+  return static_cast<size_t>(out - jmutf8);
+}
+
+void JavaModifiedUtf8::encode(const char16_t c, std::string& jmutf8) {
+  char buf[3];
+  jmutf8.append(buf, encodeUnit(c, buf));
 }
 
-std::u16string JavaModifiedUtf8::decode(const char* buf, uint16_t len) {
+std::u16string JavaModifiedUtf8::decode(const char* buf, size_t len) {
   std::u16string value;
-  const auto end = buf + len;
-  while (buf < end) {
-    value += decodeJavaModifiedUtf8Char(&buf);
-  }
+  decode(buf, len, value);
   return value;
 }
 
+void JavaModifiedUtf8::decode(const char* buf, size_t len, std::string& utf8) {
+  utf8.clear();
+  utf8.reserve(len);
+  auto p = reinterpret_cast<const uint8_t*>(buf);
+  const auto end = p + len;
+  while (p < end) {
+    if (*p < 0x80) {
+      const auto ascii = asciiLength<true>(p, end);
+      utf8.append(reinterpret_cast<const char*>(p), ascii);
+      p += ascii;
+    } else {
+      appendUtf8(decodeCodePoint(p, end), utf8);
+    }
+  }
+}
+
+void JavaModifiedUtf8::decode(const char* buf, size_t len,
+                              std::u16string& utf16) {
+  // every code unit takes at least one byte
+  utf16.resize(len);
+  const auto begin = &utf16[0];
+  auto out = begin;
+  auto p = reinterpret_cast<const uint8_t*>(buf);
+  const auto end = p + len;
+  while (p < end) {
+    if (*p < 0x80) {
+      const auto ascii = copyAscii(p, static_cast<size_t>(end - p), out);
+      p += ascii;
+      out += ascii;
+    } else {
+      *(out++) = decodeUnit(p, end);
+    }
+  }
+  utf16.resize(static_cast<size_t>(out - begin));
+}
+
+void JavaModifiedUtf8::decode(const char* buf, size_t len,
+                              std::u32string& ucs4) {
+  // every code point takes at least one byte
+  ucs4.resize(len);
+  const auto begin = &ucs4[0];
+  auto out = begin;
+  auto p = reinterpret_cast<const uint8_t*>(buf);
+  const auto end = p + len;
+  while (p < end) {
+    if (*p < 0x80) {
+      const auto ascii = copyAscii(p, static_cast<size_t>(end - p), out);
+      p += ascii;
+      out += ascii;
+    } else {
+      *(out++) = decodeCodePoint(p, end);
+    }
+  }
+  ucs4.resize(static_cast<size_t>(out - begin));
+}
+
 char16_t JavaModifiedUtf8::decodeJavaModifiedUtf8Char(const char** pbuf) {
   char16_t c;
 
@@ -27,13 +27,26 @@ namespace geode {
 namespace client {
 namespace internal {
 
+/**
+ * Codec for Java Modified UTF-8, the string encoding of Java's DataInput and
+ * DataOutput. It differs from UTF-8 in encoding NUL as two bytes and
+ * supplementary characters as a surrogate pair of three bytes each.
+ *
+ * Conversions go directly between Java Modified UTF-8 and UTF-8, UTF-16 or
+ * UCS-4. Runs of ASCII, which make up most keys and values, are found a
+ * vector at a time and copied in bulk.
+ */
 struct JavaModifiedUtf8 {
   /**
    * Calculate the length of the given UTF-8 string when encoded in Java
    * Modified UTF-8.
+   *
+   * @throws std::range_error if the string is not valid UTF-8.
    */
   static size_t encodedLength(const std::string& utf8);
 
+  static size_t encodedLength(const char* utf8, size_t length);
+
   /**
    * Calculate the length of the given UTF-16 string when encoded in Java
    * Modified UTF-8.
@@ -42,8 +55,16 @@ struct JavaModifiedUtf8 {
 
   static size_t encodedLength(const char16_t* data, size_t length);
 
+  /**
+   * Calculate the length of the given UCS-4 string when encoded in Java
+   * Modified UTF-8.
+   */
+  static size_t encodedLength(const char32_t* ucs4, size_t length);
+
   /**
    * Converts given UTF-8 string to Java Modified UTF-8 string.
+   *
+   * @throws std::range_error if the string is not valid UTF-8.
    */
   static std::string fromString(const std::string& utf8);
 
@@ -52,12 +73,39 @@ struct JavaModifiedUtf8 {
    */
   static std::string fromString(const std::u16string& utf16);
 
+  /**
+   * Encodes <code>length</code> code units into at most <code>capacity</code>
+   * bytes of Java Modified UTF-8 at <code>jmutf8</code>. Encoding stops ahead
+   * of the first character that does not fit, it is never split.
+   *
+   * @return the number of bytes written.
+   * @throws std::range_error if <code>utf8</code> is not valid UTF-8.
+   */
+  static size_t encode(const char* utf8, size_t length, char* jmutf8,
+                       size_t capacity);
+
+  static size_t encode(const char16_t* utf16, size_t length, char* jmutf8,
+                       size_t capacity);
+
+  static size_t encode(const char32_t* ucs4, size_t length, char* jmutf8,
+                       size_t capacity);
+
   /**
    * Converts a single UTF-16 code unit into Java Modified UTF-8 code units.
    */
   static void encode(const char16_t c, std::string& jmutf8);
 
-  static std::u16string decode(const char* buf, uint16_t len);
+  static std::u16string decode(const char* buf, size_t len);
+
+  /**
+   * Decodes <code>len</code> bytes of Java Modified UTF-8 into the given
+   * string, replacing its contents.
+   */
+  static void decode(const char* buf, size_t len, std::string& utf8);
+
+  static void decode(const char* buf, size_t len, std::u16string& utf16);
+
+  static void decode(const char* buf, size_t len, std::u32string& ucs4);
 
   static char16_t decodeJavaModifiedUtf8Char(const char** pbuf);
 };
@@ -0,0 +1,233 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Lz4.hpp"
+
+#include <cstring>
+
+namespace apache {
+namespace geode {
+namespace client {
+namespace internal {
+
+namespace {
+
+const size_t MIN_MATCH = 4;
+// the last match must start this many bytes before the end of the block
+const size_t MF_LIMIT = 12;
+// and the block must end with at least this many literals
+const size_t LAST_LITERALS = 5;
+const size_t MAX_OFFSET = 65535;
+const int HASH_LOG = 12;
+// after this many misses in a row, every further miss skips ahead faster
+const int SKIP_TRIGGER = 6;
+
+inline uint32_t read32(const uint8_t* p) {
+  uint32_t value;
+  std::memcpy(&value, p, sizeof(value));
+  return value;
+}
+
+inline uint32_t hash(uint32_t sequence) {
+  return (sequence * 2654435761U) >> (32 - HASH_LOG);
+}
+
+inline size_t lengthBytes(size_t length) {
+  return length >= 15 ? (length - 15) / 255 + 1 : 0;
+}
+
+inline uint8_t* writeLength(uint8_t* op, size_t length) {
+  for (length -= 15; length >= 255; length -= 255) {
+    *op++ = 255;
+  }
+  *op++ = static_cast<uint8_t>(length);
+  return op;
+}
+
+/**
+ * Writes a sequence of literals followed by a match, or just the final
+ * literals if <code>matchLength</code> is 0. Returns nullptr if it does not
+ * fit.
+ */
+uint8_t* writeSequence(uint8_t* op, uint8_t* end, const uint8_t* literals,
+                       size_t literalLength, size_t offset,
+                       size_t matchLength) {
+  auto matchCode = matchLength > 0 ? matchLength - MIN_MATCH : 0;
+  auto needed = 1 + lengthBytes(literalLength) + literalLength;
+  if (matchLength > 0) {
+    needed += 2 + lengthBytes(matchCode);
+  }
+  if (needed > static_cast<size_t>(end - op)) {
+    return nullptr;
+  }
+
+  auto token = op++;
+  if (literalLength >= 15) {
+    *token = 15 << 4;
+    op = writeLength(op, literalLength);
+  } else {
+    *token = static_cast<uint8_t>(literalLength << 4);
+  }
+  if (literalLength > 0) {
+    std::memcpy(op, literals, literalLength);
+    op += literalLength;
+  }
+
+  if (matchLength > 0) {
+    *op++ = static_cast<uint8_t>(offset);
+    *op++ = static_cast<uint8_t>(offset >> 8);
+    if (matchCode >= 15) {
+      *token |= 15;
+      op = writeLength(op, matchCode);
+    } else {
+      *token |= static_cast<uint8_t>(matchCode);
+    }
+  }
+  return op;
+}
+
+/**
+ * Reads the extension bytes of a length whose token nibble was 15.
+ */
+inline bool readLength(const uint8_t*& ip, const uint8_t* end,
+                       size_t& length) {
+  uint8_t byte;
+  do {
+    if (ip == end) {
+      return false;
+    }
+    byte = *ip++;
+    length += byte;
+  } while (byte == 255);
+  return true;
+}
+
+}  // namespace
+
+size_t Lz4::compress(const uint8_t* source, size_t length,
+                     uint8_t* destination, size_t capacity) {
+  auto op = destination;
+  auto end = destination + capacity;
+  size_t anchor = 0;
+
+  if (length > MF_LIMIT) {
+    // stale entries are harmless, every candidate is verified before use
+    static thread_local uint32_t table[1 << HASH_LOG];
+    const auto matchStartLimit = length - MF_LIMIT;
+    const auto matchEndLimit = length - LAST_LITERALS;
+
+    size_t position = 0;
+    size_t misses = 0;
+    while (position <= matchStartLimit) {
+      auto sequence = read32(source + position);
+      auto& entry = table[hash(sequence)];
+      size_t candidate = entry;
+      entry = static_cast<uint32_t>(position);
+
+      if (candidate >= position || position - candidate > MAX_OFFSET ||
+          read32(source + candidate) != sequence) {
+        position += 1 + (misses++ >> SKIP_TRIGGER);
+        continue;
+      }
+      misses = 0;
+
+      auto matchLength = MIN_MATCH;
+      while (position + matchLength < matchEndLimit &&
+             source[candidate + matchLength] ==
+                 source[position + matchLength]) {
+        matchLength++;
+      }
+
+      op = writeSequence(op, end, source + anchor, position - anchor,
+                         position - candidate, matchLength);
+      if (op == nullptr) {
+        return 0;
+      }
+      position += matchLength;
+      anchor = position;
+    }
+  }
+
+  op = writeSequence(op, end, source + anchor, length - anchor, 0, 0);
+  return op == nullptr ? 0 : static_cast<size_t>(op - destination);
+}
+
+bool Lz4::decompress(const uint8_t* source, size_t length,
+                     uint8_t* destination, size_t decompressedLength) {
+  auto ip = source;
+  auto end = source + length;
+  size_t written = 0;
+
+  while (ip != end) {
+    auto token = *ip++;
+
+    size_t literalLength = token >> 4;
+    if (literalLength == 15 && !readLength(ip, end, literalLength)) {
+      return false;
+    }
+    if (literalLength > static_cast<size_t>(end - ip) ||
+        literalLength > decompressedLength - written) {
+      return false;
+    }
+    if (literalLength > 0) {
+      std::memcpy(destination + written, ip, literalLength);
+      ip += literalLength;
+      written += literalLength;
+    }
+
+    if (ip == end) {
+      break;
+    }
+
+    if (end - ip < 2) {
+      return false;
+    }
+    size_t offset = ip[0] | (ip[1] << 8);
+    ip += 2;
+    if (offset == 0 || offset > written) {
+      return false;
+    }
+
+    size_t matchLength = token & 15;
+    if (matchLength == 15 && !readLength(ip, end, matchLength)) {
+      return false;
+    }
+    matchLength += MIN_MATCH;
+    if (matchLength > decompressedLength - written) {
+      return false;
+    }
+
+    auto from = destination + written - offset;
+    auto to = destination + written;
+    if (offset >= matchLength) {
+      std::memcpy(to, from, matchLength);
+    } else {
+      // overlapping matches repeat the last offset bytes
+      for (size_t i = 0; i < matchLength; i++) {
+        to[i] = from[i];
+      }
+    }
+    written += matchLength;
+  }
+
+  return written == decompressedLength;
+}
+
+}  // namespace internal
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
@@ -0,0 +1,64 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_UTIL_LZ4_H_
+#define GEODE_UTIL_LZ4_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace apache {
+namespace geode {
+namespace client {
+namespace internal {
+
+/**
+ * Codec for the LZ4 block format, a byte oriented LZ77 variant that trades
+ * some ratio for compressing and decompressing at memory speed. Blocks are
+ * interchangeable with those of the reference implementation.
+ */
+struct Lz4 {
+  /**
+   * Compresses <code>length</code> bytes at <code>source</code> into at
+   * most <code>capacity</code> bytes at <code>destination</code>.
+   *
+   * @returns the compressed length, or 0 if the compressed block does not
+   * fit into <code>capacity</code>.
+   */
+  static size_t compress(const uint8_t* source, size_t length,
+                         uint8_t* destination, size_t capacity);
+
+  /**
+   * Decompresses the block of <code>length</code> bytes at
+   * <code>source</code>, which must expand to exactly
+   * <code>decompressedLength</code> bytes at <code>destination</code>.
+   *
+   * @returns false if the block is malformed or of a different decompressed
+   * length.
+   */
+  static bool decompress(const uint8_t* source, size_t length,
+                         uint8_t* destination, size_t decompressedLength);
+};
+
+}  // namespace internal
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_UTIL_LZ4_H_
@@ -0,0 +1,131 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "coarse_clock.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+namespace apache {
+namespace geode {
+namespace util {
+namespace chrono {
+
+constexpr bool coarse_system_clock::is_steady;
+constexpr bool coarse_steady_clock::is_steady;
+
+namespace {
+
+/**
+ * Holds the times of the last tick, or 0 while the clocks are not ticking.
+ * The instance is intentionally never destroyed, so the clocks remain
+ * usable by static destructors during shutdown.
+ */
+class ticker {
+ public:
+  static ticker& instance() {
+    static auto instance = new ticker();
+    return *instance;
+  }
+
+  std::atomic<std::chrono::system_clock::rep> system_;
+  std::atomic<std::chrono::steady_clock::rep> steady_;
+
+  void acquire() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (users_++ == 0) {
+      tick();
+      auto generation = generation_;
+      thread_ = std::thread([this, generation] { run(generation); });
+    }
+  }
+
+  void release() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (--users_ == 0) {
+      ++generation_;
+      stopped_.notify_all();
+      auto thread = std::move(thread_);
+      lock.unlock();
+      thread.join();
+
+      lock.lock();
+      if (users_ == 0) {
+        system_.store(0, std::memory_order_relaxed);
+        steady_.store(0, std::memory_order_relaxed);
+      }
+    }
+  }
+
+ private:
+  std::mutex mutex_;
+  std::condition_variable stopped_;
+  std::thread thread_;
+  size_t users_;
+  // advanced by each stop, so a thread still being joined is not revived
+  // by a start in the meantime
+  uint64_t generation_;
+
+  ticker() : system_(0), steady_(0), users_(0), generation_(0) {}
+
+  void run(uint64_t generation) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!stopped_.wait_for(lock, coarse_clock_resolution, [&] {
+      return generation_ != generation;
+    })) {
+      tick();
+    }
+  }
+
+  void tick() {
+    system_.store(
+        std::chrono::system_clock::now().time_since_epoch().count(),
+        std::memory_order_relaxed);
+    steady_.store(
+        std::chrono::steady_clock::now().time_since_epoch().count(),
+        std::memory_order_relaxed);
+  }
+};
+
+}  // namespace
+
+coarse_clock_ticker::coarse_clock_ticker() { ticker::instance().acquire(); }
+
+coarse_clock_ticker::~coarse_clock_ticker() { ticker::instance().release(); }
+
+coarse_system_clock::time_point coarse_system_clock::now() {
+  if (auto ticks =
+          ticker::instance().system_.load(std::memory_order_relaxed)) {
+    return time_point(duration(ticks));
+  }
+  return std::chrono::system_clock::now();
+}
+
+coarse_steady_clock::time_point coarse_steady_clock::now() {
+  if (auto ticks =
+          ticker::instance().steady_.load(std::memory_order_relaxed)) {
+    return time_point(duration(ticks));
+  }
+  return std::chrono::steady_clock::now();
+}
+
+}  // namespace chrono
+}  // namespace util
+}  // namespace geode
+}  // namespace apache
@@ -0,0 +1,86 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_UTIL_CHRONO_COARSE_CLOCK_H_
+#define GEODE_UTIL_CHRONO_COARSE_CLOCK_H_
+
+#include <chrono>
+
+namespace apache {
+namespace geode {
+namespace util {
+namespace chrono {
+
+/**
+ * Interval at which the coarse clocks are advanced.
+ */
+constexpr std::chrono::milliseconds coarse_clock_resolution{1};
+
+/**
+ * Keeps the coarse clocks ticking for as long as any instance exists. The
+ * first instance starts the ticking thread and the last one to be
+ * destroyed stops and joins it.
+ */
+class coarse_clock_ticker {
+ public:
+  coarse_clock_ticker();
+  ~coarse_clock_ticker();
+
+  coarse_clock_ticker(const coarse_clock_ticker&) = delete;
+  coarse_clock_ticker& operator=(const coarse_clock_ticker&) = delete;
+};
+
+/**
+ * A system_clock whose now() returns the time of the most recent tick of a
+ * background thread instead of querying the operating system. Reading it is
+ * a single relaxed load, at the cost of lagging the real time by up to
+ * coarse_clock_resolution. While no coarse_clock_ticker exists, now() reads
+ * std::chrono::system_clock.
+ */
+class coarse_system_clock {
+ public:
+  typedef std::chrono::system_clock::duration duration;
+  typedef duration::rep rep;
+  typedef duration::period period;
+  typedef std::chrono::system_clock::time_point time_point;
+  static constexpr bool is_steady = false;
+
+  static time_point now();
+};
+
+/**
+ * A steady_clock counterpart of coarse_system_clock.
+ */
+class coarse_steady_clock {
+ public:
+  typedef std::chrono::steady_clock::duration duration;
+  typedef duration::rep rep;
+  typedef duration::period period;
+  typedef std::chrono::steady_clock::time_point time_point;
+  static constexpr bool is_steady = true;
+
+  static time_point now();
+};
+
+}  // namespace chrono
+}  // namespace util
+}  // namespace geode
+}  // namespace apache
+
+#endif /* GEODE_UTIL_CHRONO_COARSE_CLOCK_H_ */
@@ -0,0 +1,111 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "hazard_pointer.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace apache {
+namespace geode {
+namespace util {
+namespace concurrent {
+
+namespace {
+
+const size_t CACHE_LINE_SIZE = 64;
+const size_t SLOTS_PER_THREAD = 4;
+
+// Records are never freed, a thread that exits hands its record to the next
+// thread that needs one.
+struct record {
+  record() : in_use(true), next(nullptr) {
+    for (auto &slot : slots) {
+      slot.store(nullptr, std::memory_order_relaxed);
+    }
+  }
+
+  std::atomic<bool> in_use;
+  std::atomic<const void *> slots[SLOTS_PER_THREAD];
+  record *next;
+  char padding[CACHE_LINE_SIZE];
+};
+
+std::atomic<record *> records(nullptr);
+
+record *acquire_record() {
+  for (auto r = records.load(); r; r = r->next) {
+    bool in_use = false;
+    if (!r->in_use.load(std::memory_order_relaxed) &&
+        r->in_use.compare_exchange_strong(in_use, true)) {
+      return r;
+    }
+  }
+
+  auto r = new record();
+  auto head = records.load();
+  do {
+    r->next = head;
+  } while (!records.compare_exchange_weak(head, r));
+  return r;
+}
+
+struct thread_record {
+  thread_record() : owned(acquire_record()), depth(0) {}
+  ~thread_record() { owned->in_use.store(false, std::memory_order_release); }
+
+  record *owned;
+  size_t depth;
+};
+
+thread_record &this_thread_record() {
+  static thread_local thread_record r;
+  return r;
+}
+
+}  // namespace
+
+hazard_pointer::hazard_pointer() {
+  auto &r = this_thread_record();
+  if (r.depth == SLOTS_PER_THREAD) {
+    throw std::logic_error("too many nested hazard pointers");
+  }
+  slot_ = &r.owned->slots[r.depth++];
+}
+
+hazard_pointer::~hazard_pointer() {
+  slot_->store(nullptr, std::memory_order_release);
+  --this_thread_record().depth;
+}
+
+std::vector<const void *> hazard_pointer::protected_pointers() {
+  std::vector<const void *> pointers;
+  for (auto r = records.load(); r; r = r->next) {
+    for (auto &slot : r->slots) {
+      if (auto pointer = slot.load()) {
+        pointers.push_back(pointer);
+      }
+    }
+  }
+  std::sort(pointers.begin(), pointers.end());
+  return pointers;
+}
+
+} /* namespace concurrent */
+} /* namespace util */
+} /* namespace geode */
+} /* namespace apache */
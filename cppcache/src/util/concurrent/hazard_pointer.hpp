@@ -0,0 +1,77 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_UTIL_CONCURRENT_HAZARD_POINTER_H_
+#define GEODE_UTIL_CONCURRENT_HAZARD_POINTER_H_
+
+#include <atomic>
+#include <vector>
+
+#include "apache-geode_export.h"
+
+namespace apache {
+namespace geode {
+namespace util {
+namespace concurrent {
+
+/**
+ * Announces that the current thread is reading an object another thread may
+ * retire at any time, see snapshot.
+ *
+ * Each thread owns a few slots on a cache line of its own, so protecting an
+ * object writes no memory shared with other readers. A writer that retired
+ * an object frees it only once protected() no longer lists it.
+ */
+class APACHE_GEODE_EXPORT hazard_pointer final {
+ public:
+  hazard_pointer();
+  ~hazard_pointer();
+
+  hazard_pointer(const hazard_pointer &) = delete;
+  hazard_pointer &operator=(const hazard_pointer &) = delete;
+
+  template <class T>
+  const T *protect(const std::atomic<const T *> &source) {
+    auto pointer = source.load();
+    while (true) {
+      // pairs with the writer swapping source before scanning protected()
+      slot_->store(pointer);
+      auto current = source.load();
+      if (current == pointer) {
+        return pointer;
+      }
+      pointer = current;
+    }
+  }
+
+  /**
+   * Returns every pointer currently protected by any thread, sorted.
+   */
+  static std::vector<const void *> protected_pointers();
+
+ private:
+  std::atomic<const void *> *slot_;
+};
+
+} /* namespace concurrent */
+} /* namespace util */
+} /* namespace geode */
+} /* namespace apache */
+
+#endif /* GEODE_UTIL_CONCURRENT_HAZARD_POINTER_H_ */
@@ -0,0 +1,163 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "sharded_shared_mutex.hpp"
+
+#include <thread>
+
+namespace apache {
+namespace geode {
+namespace util {
+namespace concurrent {
+
+namespace {
+
+const size_t MAX_SHARDS = 64;
+
+// yields before a blocked thread goes to sleep
+const int MAX_SPINS = 16;
+
+size_t shard_count() {
+  static const size_t count = [] {
+    size_t count = 1;
+    auto threads = static_cast<size_t>(std::thread::hardware_concurrency());
+    while (count < threads && count < MAX_SHARDS) {
+      count <<= 1;
+    }
+    return count;
+  }();
+  return count;
+}
+
+size_t this_thread_index() {
+  static std::atomic<size_t> next_index(0);
+  static thread_local size_t index = next_index++;
+  return index;
+}
+
+}  // namespace
+
+sharded_shared_mutex::sharded_shared_mutex()
+    : mask_(shard_count() - 1),
+      shards_(new shard[mask_ + 1]),
+      writer_(false),
+      waiters_(0) {}
+
+void sharded_shared_mutex::lock() {
+  for (int spins = 0; spins < MAX_SPINS; ++spins) {
+    if (try_lock()) {
+      return;
+    }
+    std::this_thread::yield();
+  }
+
+  writer_mutex_.lock();
+  while (!announce_writer()) {
+    wait_until([this] { return !has_readers(); });
+  }
+}
+
+bool sharded_shared_mutex::try_lock() {
+  if (!writer_mutex_.try_lock()) {
+    return false;
+  }
+
+  if (!announce_writer()) {
+    writer_mutex_.unlock();
+    return false;
+  }
+  return true;
+}
+
+void sharded_shared_mutex::unlock() {
+  writer_.store(false);
+  writer_mutex_.unlock();
+  wake_waiters();
+}
+
+void sharded_shared_mutex::lock_shared() {
+  for (int spins = 0; !try_lock_shared(); ++spins) {
+    if (spins < MAX_SPINS) {
+      std::this_thread::yield();
+    } else {
+      wait_until([this] { return !writer_.load(); });
+    }
+  }
+}
+
+bool sharded_shared_mutex::try_lock_shared() {
+  auto &readers = this_thread_shard().readers;
+  readers.fetch_add(1);
+  if (writer_.load()) {
+    readers.fetch_sub(1);
+    wake_waiters();
+    return false;
+  }
+  return true;
+}
+
+void sharded_shared_mutex::unlock_shared() {
+  this_thread_shard().readers.fetch_sub(1);
+  wake_waiters();
+}
+
+sharded_shared_mutex::shard &sharded_shared_mutex::this_thread_shard() {
+  return shards_[this_thread_index() & mask_];
+}
+
+bool sharded_shared_mutex::has_readers() const {
+  for (size_t i = 0; i <= mask_; ++i) {
+    if (shards_[i].readers.load() != 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool sharded_shared_mutex::announce_writer() {
+  // pairs with try_lock_shared, either the reader sees the writer or this
+  // thread sees the reader
+  writer_.store(true);
+  if (has_readers()) {
+    writer_.store(false);
+    wake_waiters();
+    return false;
+  }
+  return true;
+}
+
+void sharded_shared_mutex::wake_waiters() {
+  // a waiter registers before it checks the lock, so either it sees the
+  // change that preceded this call or it is seen here
+  if (waiters_.load() > 0) {
+    std::lock_guard<std::mutex> guard(wait_mutex_);
+    wait_condition_.notify_all();
+  }
+}
+
+template <class Predicate>
+void sharded_shared_mutex::wait_until(Predicate ready) {
+  std::unique_lock<std::mutex> lock(wait_mutex_);
+  waiters_.fetch_add(1);
+  wait_condition_.wait(lock, ready);
+  waiters_.fetch_sub(1);
+}
+
+} /* namespace concurrent */
+} /* namespace util */
+} /* namespace geode */
+} /* namespace apache */
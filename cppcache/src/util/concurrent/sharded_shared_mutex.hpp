@@ -0,0 +1,100 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_UTIL_CONCURRENT_SHARDED_SHARED_MUTEX_H_
+#define GEODE_UTIL_CONCURRENT_SHARDED_SHARED_MUTEX_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+#include "apache-geode_export.h"
+
+namespace apache {
+namespace geode {
+namespace util {
+namespace concurrent {
+
+/**
+ * Reader/writer lock for data that is read all the time and written almost
+ * never, like the lifecycle of a region.
+ *
+ * Each thread counts its shared locks in a shard of its own cache line, so
+ * readers on different cores do not contend. The price is paid by writers,
+ * which have to look at every shard. Readers take precedence: a writer only
+ * gets the lock when no reader holds it, which also makes shared locks
+ * recursive. Threads that do not get the lock after a short spin sleep on a
+ * condition variable until an unlock wakes them.
+ */
+class APACHE_GEODE_EXPORT sharded_shared_mutex final {
+ public:
+  sharded_shared_mutex();
+  ~sharded_shared_mutex() = default;
+
+  sharded_shared_mutex(const sharded_shared_mutex &) = delete;
+  sharded_shared_mutex &operator=(const sharded_shared_mutex &) = delete;
+
+  void lock();
+
+  bool try_lock();
+
+  void unlock();
+
+  void lock_shared();
+
+  bool try_lock_shared();
+
+  void unlock_shared();
+
+ private:
+  static const size_t CACHE_LINE_SIZE = 64;
+
+  struct shard {
+    shard() : readers(0) {}
+
+    std::atomic<int32_t> readers;
+    char padding[CACHE_LINE_SIZE - sizeof(std::atomic<int32_t>)];
+  };
+
+  const size_t mask_;
+  std::unique_ptr<shard[]> shards_;
+  std::atomic<bool> writer_;
+  std::mutex writer_mutex_;
+
+  std::atomic<int32_t> waiters_;
+  std::mutex wait_mutex_;
+  std::condition_variable wait_condition_;
+
+  shard &this_thread_shard();
+  bool has_readers() const;
+  bool announce_writer();
+  void wake_waiters();
+
+  template <class Predicate>
+  void wait_until(Predicate ready);
+};
+
+} /* namespace concurrent */
+} /* namespace util */
+} /* namespace geode */
+} /* namespace apache */
+
+#endif /* GEODE_UTIL_CONCURRENT_SHARDED_SHARED_MUTEX_H_ */
@@ -0,0 +1,109 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_UTIL_CONCURRENT_SNAPSHOT_H_
+#define GEODE_UTIL_CONCURRENT_SNAPSHOT_H_
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "hazard_pointer.hpp"
+
+namespace apache {
+namespace geode {
+namespace util {
+namespace concurrent {
+
+/**
+ * Immutable value that is read all the time and replaced almost never, like
+ * a map of types.
+ *
+ * Readers take no lock and touch no reference count. Writers copy the value,
+ * change the copy and publish it. The value it replaced is freed as soon as
+ * no reader protects it any longer.
+ */
+template <class T>
+class snapshot final {
+ public:
+  snapshot() : current_(new T()) {}
+
+  ~snapshot() { delete current_.load(); }
+
+  snapshot(const snapshot &) = delete;
+  snapshot &operator=(const snapshot &) = delete;
+
+  /**
+   * Calls function with the current value. The value must not escape the
+   * call.
+   */
+  template <class Function>
+  auto read(Function function) const
+      -> decltype(function(std::declval<const T &>())) {
+    hazard_pointer hazard;
+    return function(*hazard.protect(current_));
+  }
+
+  /**
+   * Publishes a copy of the current value changed by function.
+   */
+  template <class Function>
+  void update(Function function) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    std::unique_ptr<T> updated(new T(*current_.load()));
+    function(*updated);
+    retire(current_.exchange(updated.release()));
+  }
+
+  /**
+   * Publishes an empty value.
+   */
+  void clear() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    retire(current_.exchange(new T()));
+  }
+
+ private:
+  std::atomic<const T *> current_;
+  std::vector<std::unique_ptr<const T>> retired_;
+  std::mutex mutex_;
+
+  void retire(const T *value) {
+    retired_.emplace_back(value);
+    auto hazards = hazard_pointer::protected_pointers();
+    retired_.erase(
+        std::remove_if(retired_.begin(), retired_.end(),
+                       [&hazards](const std::unique_ptr<const T> &retired) {
+                         return !std::binary_search(
+                             hazards.begin(), hazards.end(),
+                             static_cast<const void *>(retired.get()));
+                       }),
+        retired_.end());
+  }
+};
+
+} /* namespace concurrent */
+} /* namespace util */
+} /* namespace geode */
+} /* namespace apache */
+
+#endif /* GEODE_UTIL_CONCURRENT_SNAPSHOT_H_ */
@@ -57,6 +57,34 @@ class TestObject {
   }
 };
 
+class PartitionedTestObject : public TestObject {
+ public:
+  explicit PartitionedTestObject(int partition) : partition_(partition) {}
+  int partition() const { return partition_; }
+
+ private:
+  const int partition_;
+};
+
+class PartitionedConnectionQueue
+    : public ConnectionQueue<PartitionedTestObject> {
+ public:
+  PartitionedTestObject* getFrom(int partition) {
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+    return popNoLock(toPartition(partition));
+  }
+
+ protected:
+  const void* partitionOf(const PartitionedTestObject* object) const override {
+    return toPartition(object->partition());
+  }
+
+ private:
+  static const void* toPartition(int partition) {
+    return reinterpret_cast<const void*>(static_cast<intptr_t>(partition + 1));
+  }
+};
+
 TEST(ConnectionQueueTest, constructedEmpty) {
   ConnectionQueue<TestObject> queue;
   EXPECT_THAT(queue, IsEmpty());
@@ -215,3 +243,44 @@ TEST(ConnectionQueueTest, getUntilOnEmptyWaitsAndReturnsNullWhenClosed) {
   queue.close();
   ASSERT_THAT(task1.wait_for(minutes(1)), Eq(std::future_status::ready));
 }
+
+TEST(ConnectionQueueTest, getFromPartitionReturnsMostRecentOfPartition) {
+  PartitionedConnectionQueue queue;
+  const auto first = new PartitionedTestObject(1);
+  const auto second = new PartitionedTestObject(2);
+  const auto third = new PartitionedTestObject(1);
+  queue.put(first, false);
+  queue.put(second, false);
+  queue.put(third, false);
+
+  EXPECT_THAT(queue.getFrom(1), Eq(third));
+  EXPECT_THAT(queue, SizeIs(2));
+  EXPECT_THAT(queue.getFrom(1), Eq(first));
+  EXPECT_THAT(queue.getFrom(1), IsNull());
+  EXPECT_THAT(queue.getFrom(3), IsNull());
+  EXPECT_THAT(queue, SizeIs(1));
+
+  delete first;
+  delete third;
+  queue.close();
+}
+
+TEST(ConnectionQueueTest, getFromPartitionKeepsQueueOrder) {
+  PartitionedConnectionQueue queue;
+  const auto first = new PartitionedTestObject(1);
+  const auto second = new PartitionedTestObject(2);
+  const auto third = new PartitionedTestObject(3);
+  queue.put(first, false);
+  queue.put(second, false);
+  queue.put(third, false);
+
+  EXPECT_THAT(queue.getFrom(2), Eq(second));
+  EXPECT_THAT(queue.getNoWait(), Eq(first));
+  EXPECT_THAT(queue.getNoWait(), Eq(third));
+  EXPECT_THAT(queue.getNoWait(), IsNull());
+  EXPECT_THAT(queue.getFrom(3), IsNull());
+
+  delete first;
+  delete second;
+  delete third;
+}
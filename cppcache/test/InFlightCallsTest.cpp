@@ -0,0 +1,167 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "InFlightCalls.hpp"
+
+using apache::geode::client::InFlightCalls;
+
+namespace {
+
+TEST(InFlightCallsTest, callerGetsResult) {
+  InFlightCalls<std::string, int> calls;
+  bool shared = true;
+  EXPECT_EQ(1, calls.run("key", [] { return 1; }, shared));
+  EXPECT_FALSE(shared);
+  EXPECT_EQ(0, calls.size());
+}
+
+TEST(InFlightCallsTest, concurrentCallersShareCall) {
+  InFlightCalls<std::string, int> calls;
+  const int waiters = 4;
+  std::atomic<int> callCount(0);
+  std::atomic<int> arrived(0);
+  std::atomic<bool> release(false);
+  std::atomic<int> sharedCount(0);
+
+  auto get = [&] {
+    bool shared = false;
+    auto result = calls.run(
+        "key",
+        [&] {
+          ++callCount;
+          while (!release) {
+            std::this_thread::yield();
+          }
+          return 42;
+        },
+        shared);
+    EXPECT_EQ(42, result);
+    if (shared) {
+      ++sharedCount;
+    }
+  };
+
+  std::thread caller(get);
+  while (calls.size() == 0) {
+    std::this_thread::yield();
+  }
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < waiters; ++i) {
+    threads.emplace_back([&] {
+      ++arrived;
+      get();
+    });
+  }
+  while (arrived < waiters) {
+    std::this_thread::yield();
+  }
+  // give the waiters time to block on the call in progress
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  release = true;
+
+  caller.join();
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(1, callCount);
+  EXPECT_EQ(waiters, sharedCount);
+  EXPECT_EQ(0, calls.size());
+}
+
+TEST(InFlightCallsTest, differentKeysDoNotShare) {
+  InFlightCalls<std::string, int> calls;
+  bool shared = true;
+  auto result = calls.run(
+      "one",
+      [&] {
+        bool innerShared = true;
+        auto inner = calls.run("two", [] { return 2; }, innerShared);
+        EXPECT_FALSE(innerShared);
+        return inner + 1;
+      },
+      shared);
+  EXPECT_EQ(3, result);
+  EXPECT_FALSE(shared);
+}
+
+TEST(InFlightCallsTest, nestedCallForSameKeyRunsOnItsOwn) {
+  InFlightCalls<std::string, int> calls;
+  bool shared = true;
+  auto result = calls.run(
+      "key",
+      [&] {
+        bool innerShared = true;
+        auto inner = calls.run("key", [] { return 1; }, innerShared);
+        EXPECT_FALSE(innerShared);
+        return inner + 1;
+      },
+      shared);
+  EXPECT_EQ(2, result);
+  EXPECT_EQ(0, calls.size());
+}
+
+TEST(InFlightCallsTest, exceptionIsRethrownToAllCallers) {
+  InFlightCalls<std::string, int> calls;
+  std::atomic<bool> release(false);
+  std::atomic<bool> waiterThrew(false);
+
+  std::thread caller([&] {
+    bool shared = false;
+    EXPECT_THROW(calls.run("key",
+                           [&]() -> int {
+                             while (!release) {
+                               std::this_thread::yield();
+                             }
+                             throw std::runtime_error("failed");
+                           },
+                           shared),
+                 std::runtime_error);
+  });
+  while (calls.size() == 0) {
+    std::this_thread::yield();
+  }
+
+  std::thread waiter([&] {
+    bool shared = false;
+    try {
+      calls.run("key", []() -> int { throw std::runtime_error("own"); },
+                shared);
+    } catch (const std::runtime_error&) {
+      waiterThrew = true;
+    }
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  release = true;
+
+  caller.join();
+  waiter.join();
+  EXPECT_TRUE(waiterThrew);
+  EXPECT_EQ(0, calls.size());
+}
+
+}  // namespace
@@ -0,0 +1,93 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#if defined(__linux__)
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+
+#include <gtest/gtest.h>
+
+#include "IoUring.hpp"
+
+using apache::geode::client::IoUring;
+
+class IoUringTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    ASSERT_EQ(0, ::socketpair(AF_UNIX, SOCK_STREAM, 0, sockets_));
+  }
+
+  void TearDown() override {
+    ::close(sockets_[0]);
+    ::close(sockets_[1]);
+  }
+
+  int sockets_[2];
+};
+
+TEST_F(IoUringTest, transfersData) {
+  auto ioUring = IoUring::forThread();
+  if (!ioUring) {
+    return;
+  }
+
+  EXPECT_EQ(5,
+            ioUring->send(sockets_[0], "hello", 5, std::chrono::seconds(10)));
+
+  char buffer[16];
+  EXPECT_EQ(5, ioUring->receive(sockets_[1], buffer, sizeof(buffer),
+                                std::chrono::seconds(10)));
+  EXPECT_EQ(0, std::memcmp(buffer, "hello", 5));
+
+  ::shutdown(sockets_[0], SHUT_WR);
+  EXPECT_EQ(0, ioUring->receive(sockets_[1], buffer, sizeof(buffer),
+                                std::chrono::seconds(10)));
+}
+
+TEST_F(IoUringTest, receiveTimesOut) {
+  auto ioUring = IoUring::forThread();
+  if (!ioUring) {
+    return;
+  }
+
+  char buffer[16];
+  const auto start = std::chrono::steady_clock::now();
+  EXPECT_EQ(-1, ioUring->receive(sockets_[1], buffer, sizeof(buffer),
+                                 std::chrono::milliseconds(50)));
+  EXPECT_EQ(ETIME, errno);
+  EXPECT_LE(std::chrono::milliseconds(50),
+            std::chrono::steady_clock::now() - start);
+}
+
+TEST_F(IoUringTest, sendToClosedPeerFails) {
+  auto ioUring = IoUring::forThread();
+  if (!ioUring) {
+    return;
+  }
+
+  ::close(sockets_[1]);
+  sockets_[1] = ::socket(AF_UNIX, SOCK_STREAM, 0);
+  EXPECT_EQ(-1, ioUring->send(sockets_[0], "x", 1, std::chrono::seconds(10)));
+  EXPECT_EQ(EPIPE, errno);
+}
+
+#endif  // defined(__linux__)
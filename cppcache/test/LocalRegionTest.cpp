@@ -15,18 +15,36 @@
  * limitations under the License.
  */
 
+#include <atomic>
+#include <chrono>
+#include <thread>
+
 #include <gtest/gtest.h>
 
 #include <geode/AuthenticatedView.hpp>
 #include <geode/Cache.hpp>
+#include <geode/CacheListener.hpp>
+#include <geode/CacheLoader.hpp>
+#include <geode/CacheableString.hpp>
+#include <geode/EntryEvent.hpp>
 #include <geode/PoolManager.hpp>
 #include <geode/RegionFactory.hpp>
 #include <geode/RegionShortcut.hpp>
 
+using apache::geode::client::Cacheable;
+using apache::geode::client::CacheableKey;
+using apache::geode::client::CacheableString;
 using apache::geode::client::CacheClosedException;
 using apache::geode::client::CacheFactory;
+using apache::geode::client::CacheListener;
+using apache::geode::client::CacheLoader;
+using apache::geode::client::EntryEvent;
+using apache::geode::client::HashMapOfCacheable;
+using apache::geode::client::Serializable;
+using apache::geode::client::Region;
 using apache::geode::client::RegionAttributesFactory;
 using apache::geode::client::RegionShortcut;
+using apache::geode::client::ValueStorageType;
 
 /**
  * Cache should close and throw exceptions on methods called after close.
@@ -77,3 +95,211 @@ TEST(LocalRegionTest, subRegions) {
   auto subRegions3 = rootRegion3->subregions(true);
   EXPECT_EQ(0, subRegions3.size());
 }
+
+TEST(LocalRegionTest, serializedValueStorage) {
+  auto cache = CacheFactory{}.set("log-level", "none").create();
+  auto region = cache.createRegionFactory(RegionShortcut::LOCAL)
+                    .setValueStorage(ValueStorageType::SERIALIZED)
+                    .create("serialized");
+
+  const std::string value(1000, 'x');
+  region->put("key", value);
+
+  auto result = std::dynamic_pointer_cast<CacheableString>(region->get("key"));
+  ASSERT_NE(nullptr, result);
+  EXPECT_EQ(value, result->value());
+  // every get deserializes a copy of its own
+  EXPECT_NE(result, region->get("key"));
+
+  auto values = region->values();
+  ASSERT_EQ(1, values.size());
+  EXPECT_EQ(value,
+            std::dynamic_pointer_cast<CacheableString>(values[0])->value());
+
+  region->invalidate("key");
+  EXPECT_EQ(nullptr, region->get("key"));
+  EXPECT_TRUE(region->containsKey("key"));
+  region->destroy("key");
+  EXPECT_FALSE(region->containsKey("key"));
+}
+
+TEST(LocalRegionTest, compressedValueStorageWithDeserializedValueCache) {
+  auto cache = CacheFactory{}.set("log-level", "none").create();
+  auto region = cache.createRegionFactory(RegionShortcut::LOCAL)
+                    .setValueStorage(ValueStorageType::COMPRESSED)
+                    .setDeserializedValueCacheSize(1)
+                    .create("compressed");
+
+  region->put("key1", std::string(1000, 'x'));
+  region->put("key2", std::string(1000, 'y'));
+
+  auto result = region->get("key1");
+  EXPECT_EQ(std::string(1000, 'x'),
+            std::dynamic_pointer_cast<CacheableString>(result)->value());
+  EXPECT_EQ(result, region->get("key1"));
+
+  // pushes key1 out of the deserialized value cache
+  EXPECT_EQ(std::string(1000, 'y'),
+            std::dynamic_pointer_cast<CacheableString>(region->get("key2"))
+                ->value());
+  EXPECT_NE(result, region->get("key1"));
+
+  auto entry = region->getEntry("key2");
+  ASSERT_NE(nullptr, entry);
+  EXPECT_EQ(std::string(1000, 'y'),
+            std::dynamic_pointer_cast<CacheableString>(entry->getValue())
+                ->value());
+}
+
+TEST(LocalRegionTest, serializedValueStorageEventOldValue) {
+  class UpdateListener : public CacheListener {
+   public:
+    void afterUpdate(const EntryEvent& event) override {
+      oldValue = event.getOldValue();
+      newValue = event.getNewValue();
+    }
+
+    std::shared_ptr<Cacheable> oldValue;
+    std::shared_ptr<Cacheable> newValue;
+  };
+
+  auto listener = std::make_shared<UpdateListener>();
+  auto cache = CacheFactory{}.set("log-level", "none").create();
+  auto region = cache.createRegionFactory(RegionShortcut::LOCAL)
+                    .setValueStorage(ValueStorageType::SERIALIZED)
+                    .setCacheListener(listener)
+                    .create("serialized");
+
+  region->put("key", "one");
+  region->put("key", "two");
+
+  // the old value leaves the entry serialized and is read by the event
+  auto oldValue =
+      std::dynamic_pointer_cast<CacheableString>(listener->oldValue);
+  ASSERT_NE(nullptr, oldValue);
+  EXPECT_EQ("one", oldValue->value());
+  auto newValue =
+      std::dynamic_pointer_cast<CacheableString>(listener->newValue);
+  ASSERT_NE(nullptr, newValue);
+  EXPECT_EQ("two", newValue->value());
+}
+
+TEST(LocalRegionTest, bulkOperationsInSubBatches) {
+  auto cache = CacheFactory{}
+                   .set("log-level", "none")
+                   .set("bulk-op-batch-size", "7")
+                   .set("bulk-op-batches-in-flight", "2")
+                   .create();
+  auto region = cache.createRegionFactory(RegionShortcut::LOCAL).create("bulk");
+
+  HashMapOfCacheable map;
+  std::vector<std::shared_ptr<CacheableKey>> keys;
+  for (int i = 0; i < 100; ++i) {
+    auto key = CacheableString::create("key" + std::to_string(i));
+    map.emplace(key, CacheableString::create("value" + std::to_string(i)));
+    keys.push_back(key);
+  }
+
+  region->putAll(map);
+  EXPECT_EQ(100, region->size());
+
+  auto values = region->getAll(keys);
+  ASSERT_EQ(100, values.size());
+  for (int i = 0; i < 100; ++i) {
+    auto value = std::dynamic_pointer_cast<CacheableString>(
+        values[CacheableString::create("key" + std::to_string(i))]);
+    ASSERT_NE(nullptr, value);
+    EXPECT_EQ("value" + std::to_string(i), value->value());
+  }
+
+  keys.resize(50);
+  region->removeAll(keys);
+  EXPECT_EQ(50, region->size());
+  EXPECT_FALSE(region->containsKey("key0"));
+  EXPECT_TRUE(region->containsKey("key99"));
+}
+
+TEST(LocalRegionTest, subBatchedBulkOperationsNotifyOnCallingThread) {
+  class ThreadListener : public CacheListener {
+   public:
+    ThreadListener() : events(0), otherThreads(0) {}
+
+    void afterCreate(const EntryEvent&) override { record(); }
+    void afterDestroy(const EntryEvent&) override { record(); }
+
+    void record() {
+      ++events;
+      if (std::this_thread::get_id() != caller) {
+        ++otherThreads;
+      }
+    }
+
+    std::thread::id caller;
+    std::atomic<int> events;
+    std::atomic<int> otherThreads;
+  };
+
+  auto listener = std::make_shared<ThreadListener>();
+  listener->caller = std::this_thread::get_id();
+  auto cache = CacheFactory{}
+                   .set("log-level", "none")
+                   .set("bulk-op-batch-size", "7")
+                   .create();
+  auto region = cache.createRegionFactory(RegionShortcut::LOCAL)
+                    .setCacheListener(listener)
+                    .create("bulk");
+
+  HashMapOfCacheable map;
+  std::vector<std::shared_ptr<CacheableKey>> keys;
+  for (int i = 0; i < 50; ++i) {
+    auto key = CacheableString::create("key" + std::to_string(i));
+    map.emplace(key, CacheableString::create("value"));
+    keys.push_back(key);
+  }
+  region->putAll(map);
+  region->removeAll(keys);
+
+  EXPECT_EQ(100, listener->events);
+  EXPECT_EQ(0, listener->otherThreads);
+}
+
+TEST(LocalRegionTest, concurrentMissesShareCacheLoad) {
+  class SlowLoader : public CacheLoader {
+   public:
+    SlowLoader() : loads(0) {}
+
+    std::shared_ptr<Cacheable> load(
+        Region&, const std::shared_ptr<CacheableKey>&,
+        const std::shared_ptr<Serializable>&) override {
+      ++loads;
+      std::this_thread::sleep_for(std::chrono::milliseconds(200));
+      return CacheableString::create("loaded");
+    }
+
+    std::atomic<int> loads;
+  };
+
+  auto loader = std::make_shared<SlowLoader>();
+  auto cache = CacheFactory{}
+                   .set("log-level", "none")
+                   .set("cache-loader-coalescing-enabled", "true")
+                   .create();
+  auto region = cache.createRegionFactory(RegionShortcut::LOCAL)
+                    .setCacheLoader(loader)
+                    .create("loaded");
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i) {
+    threads.emplace_back([&region] {
+      auto value =
+          std::dynamic_pointer_cast<CacheableString>(region->get("key"));
+      ASSERT_NE(nullptr, value);
+      EXPECT_EQ("loaded", value->value());
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(1, loader->loads);
+}
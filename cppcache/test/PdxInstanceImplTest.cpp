@@ -16,7 +16,10 @@
  */
 
 #include <CachePerfStats.hpp>
+#include <CacheRegionHelper.hpp>
 #include <PdxInstanceImpl.hpp>
+#include <PdxLocalWriter.hpp>
+#include <PdxTypes.hpp>
 #include <statistics/StatisticsFactory.hpp>
 
 #include <gtest/gtest.h>
@@ -31,8 +34,18 @@
 using apache::geode::client::Cache;
 using apache::geode::client::CacheFactory;
 using apache::geode::client::CacheImpl;
+using apache::geode::client::CacheableInt32;
+using apache::geode::client::CacheableString;
 using apache::geode::client::CachePerfStats;
+using apache::geode::client::CacheRegionHelper;
+using apache::geode::client::FieldVsValues;
+using apache::geode::client::InvalidDeltaException;
+using apache::geode::client::PdxFieldTypes;
 using apache::geode::client::PdxInstanceImpl;
+using apache::geode::client::PdxLocalWriter;
+using apache::geode::client::PdxSerializable;
+using apache::geode::client::PdxType;
+using apache::geode::client::PdxTypes;
 using apache::geode::client::Properties;
 using apache::geode::statistics::StatisticsFactory;
 
@@ -68,3 +81,179 @@ TEST(PdxInstanceImplTest, updatePdxStream) {
     }
   }
 }
+
+class PdxInstanceImplSerializationTest : public ::testing::Test {
+ protected:
+  explicit PdxInstanceImplSerializationTest(
+      bool pdxInstanceDeltaEnabled = false)
+      : cache_(CacheFactory()
+                   .set("log-level", "none")
+                   .set("pdx-instance-delta-enabled",
+                        pdxInstanceDeltaEnabled ? "true" : "false")
+                   .create()),
+        cacheImpl_(CacheRegionHelper::getCacheImpl(&cache_)) {
+    auto pdxTypeRegistry = cacheImpl_->getPdxTypeRegistry();
+    auto pdxType = std::make_shared<PdxType>(
+        *pdxTypeRegistry, "PdxInstanceImplSerializationTest", false);
+    pdxType->addFixedLengthTypeField("count", "int", PdxFieldTypes::INT,
+                                     PdxTypes::INTEGER_SIZE);
+    pdxType->addVariableLengthTypeField("name", "string",
+                                        PdxFieldTypes::STRING);
+    pdxType->addVariableLengthTypeField("label", "string",
+                                        PdxFieldTypes::STRING);
+    pdxType->setTypeId(1);
+    pdxTypeRegistry->addPdxType(1, pdxType);
+
+    FieldVsValues values;
+    values.emplace("count", CacheableInt32::create(1));
+    values.emplace("name", CacheableString::create("name"));
+    values.emplace("label", CacheableString::create("label"));
+    PdxInstanceImpl writer(values, pdxType, cacheImpl_->getCachePerfStats(),
+                           *pdxTypeRegistry, *cacheImpl_, false);
+    auto output = cacheImpl_->createDataOutput();
+    PdxLocalWriter localWriter(output, pdxType, pdxTypeRegistry);
+    writer.toData(localWriter);
+    localWriter.endObjectWriting();
+    pdxStream_.assign(output.getBuffer() + 8,
+                      output.getBuffer() + output.getBufferLength());
+  }
+
+  ~PdxInstanceImplSerializationTest() noexcept override { cache_.close(); }
+
+  std::shared_ptr<PdxInstanceImpl> createInstance(
+      const std::vector<uint8_t>& pdxStream) {
+    return std::make_shared<PdxInstanceImpl>(
+        pdxStream.data(), pdxStream.size(), 1,
+        cacheImpl_->getCachePerfStats(), *cacheImpl_->getPdxTypeRegistry(),
+        *cacheImpl_, false);
+  }
+
+  // Serializes the instance and returns the bytes following the PDX header.
+  std::vector<uint8_t> serialize(const std::shared_ptr<PdxSerializable>& pdx) {
+    auto output = cacheImpl_->createDataOutput();
+    output.writeObject(pdx);
+    return std::vector<uint8_t>(output.getBuffer() + 9,
+                                output.getBuffer() + output.getBufferLength());
+  }
+
+  Cache cache_;
+  CacheImpl* cacheImpl_;
+  std::vector<uint8_t> pdxStream_;
+};
+
+TEST_F(PdxInstanceImplSerializationTest, unmodifiedInstanceWritesOriginal) {
+  auto pdxInstance = createInstance(pdxStream_);
+  EXPECT_EQ(pdxStream_, serialize(pdxInstance));
+}
+
+TEST_F(PdxInstanceImplSerializationTest, modifiedInstanceReencodesFields) {
+  auto pdxInstance = createInstance(pdxStream_);
+  auto writer = pdxInstance->createWriter();
+  writer->setField("name", std::string("a much longer name"));
+
+  auto modified = createInstance(serialize(writer));
+  EXPECT_EQ(1, modified->getIntField("count"));
+  EXPECT_EQ("a much longer name", modified->getStringField("name"));
+  EXPECT_EQ("label", modified->getStringField("label"));
+}
+
+class PdxInstanceImplDeltaTest : public PdxInstanceImplSerializationTest {
+ protected:
+  PdxInstanceImplDeltaTest() : PdxInstanceImplSerializationTest(true) {}
+
+  std::vector<uint8_t> delta(const std::shared_ptr<PdxInstanceImpl>& pdx) {
+    auto output = cacheImpl_->createDataOutput();
+    pdx->toDelta(output);
+    return std::vector<uint8_t>(output.getBuffer(),
+                                output.getBuffer() + output.getBufferLength());
+  }
+};
+
+TEST_F(PdxInstanceImplDeltaTest, deltaCarriesUpdatedFields) {
+  auto pdxInstance = createInstance(pdxStream_);
+  EXPECT_FALSE(pdxInstance->hasDelta());
+
+  auto writer =
+      std::dynamic_pointer_cast<PdxInstanceImpl>(pdxInstance->createWriter());
+  writer->setField("count", 2);
+  ASSERT_TRUE(writer->hasDelta());
+
+  auto output = cacheImpl_->createDataOutput();
+  writer->toDelta(output);
+  EXPECT_TRUE(writer->hasDelta());
+
+  auto input =
+      cacheImpl_->createDataInput(output.getBuffer(), output.getBufferLength());
+  pdxInstance->fromDelta(input);
+  EXPECT_EQ(2, pdxInstance->getIntField("count"));
+  EXPECT_EQ("name", pdxInstance->getStringField("name"));
+  EXPECT_EQ("label", pdxInstance->getStringField("label"));
+  EXPECT_EQ(serialize(writer), serialize(pdxInstance));
+}
+
+TEST_F(PdxInstanceImplSerializationTest, rejectedDeltaIsSentInFull) {
+  auto pdxInstance = createInstance(pdxStream_);
+  auto writer =
+      std::dynamic_pointer_cast<PdxInstanceImpl>(pdxInstance->createWriter());
+  writer->setField("count", 2);
+
+  auto output = cacheImpl_->createDataOutput();
+  writer->toDelta(output);
+
+  auto sent = createInstance(serialize(writer));
+  EXPECT_EQ(2, sent->getIntField("count"));
+  EXPECT_EQ("name", sent->getStringField("name"));
+  EXPECT_EQ("label", sent->getStringField("label"));
+  EXPECT_FALSE(writer->hasDelta());
+}
+
+TEST_F(PdxInstanceImplSerializationTest, fieldOutsideTypeHasNoDelta) {
+  auto pdxInstance = createInstance(pdxStream_);
+  auto writer =
+      std::dynamic_pointer_cast<PdxInstanceImpl>(pdxInstance->createWriter());
+  writer->setField("count", 2);
+  writer->setField("other", 3);
+  EXPECT_FALSE(writer->hasDelta());
+}
+
+TEST_F(PdxInstanceImplSerializationTest, deltaIsRejectedUnlessEnabled) {
+  auto pdxInstance = createInstance(pdxStream_);
+  auto writer =
+      std::dynamic_pointer_cast<PdxInstanceImpl>(pdxInstance->createWriter());
+  writer->setField("count", 2);
+
+  auto output = cacheImpl_->createDataOutput();
+  writer->toDelta(output);
+
+  auto input =
+      cacheImpl_->createDataInput(output.getBuffer(), output.getBufferLength());
+  EXPECT_THROW(pdxInstance->fromDelta(input), InvalidDeltaException);
+  EXPECT_EQ(1, pdxInstance->getIntField("count"));
+}
+
+TEST_F(PdxInstanceImplDeltaTest, deltaOfServerSideClassIsRejected) {
+  auto pdxInstance = createInstance(pdxStream_);
+
+  // a delta as a server side class might write it
+  auto output = cacheImpl_->createDataOutput();
+  output.writeInt(1);
+  output.writeString("count");
+  output.writeObject(CacheableInt32::create(2));
+
+  auto input =
+      cacheImpl_->createDataInput(output.getBuffer(), output.getBufferLength());
+  EXPECT_THROW(pdxInstance->fromDelta(input), InvalidDeltaException);
+  EXPECT_EQ(1, pdxInstance->getIntField("count"));
+}
+
+TEST_F(PdxInstanceImplDeltaTest, truncatedDeltaIsRejected) {
+  auto pdxInstance = createInstance(pdxStream_);
+  auto writer =
+      std::dynamic_pointer_cast<PdxInstanceImpl>(pdxInstance->createWriter());
+  writer->setField("name", std::string("another name"));
+
+  auto bytes = delta(writer);
+  auto input = cacheImpl_->createDataInput(bytes.data(), bytes.size() - 4);
+  EXPECT_THROW(pdxInstance->fromDelta(input), InvalidDeltaException);
+  EXPECT_EQ("name", pdxInstance->getStringField("name"));
+}
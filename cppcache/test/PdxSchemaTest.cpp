@@ -0,0 +1,174 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <geode/CacheFactory.hpp>
+#include <geode/PdxSchema.hpp>
+
+#include "CacheImpl.hpp"
+#include "CacheRegionHelper.hpp"
+#include "PdxLocalWriter.hpp"
+#include "PdxTypeRegistry.hpp"
+#include "PdxWriterWithTypeCollector.hpp"
+
+namespace {
+
+using apache::geode::client::Cache;
+using apache::geode::client::CacheFactory;
+using apache::geode::client::CacheImpl;
+using apache::geode::client::CacheRegionHelper;
+using apache::geode::client::PdxLocalWriter;
+using apache::geode::client::PdxSchemaField;
+using apache::geode::client::PdxSchemaFields;
+using apache::geode::client::PdxSchemaSerializable;
+using apache::geode::client::PdxSerializable;
+using apache::geode::client::PdxWriterWithTypeCollector;
+using apache::geode::client::Serializable;
+
+class SchemaOrder : public PdxSchemaSerializable<SchemaOrder> {
+ public:
+  int32_t id_ = 0;
+  std::string name_;
+  int16_t quantity_ = 0;
+  std::vector<std::string> tags_;
+  double price_ = 0.0;
+
+  typedef PdxSchemaFields<
+      PdxSchemaField<SchemaOrder, int32_t, &SchemaOrder::id_>,
+      PdxSchemaField<SchemaOrder, std::string, &SchemaOrder::name_>,
+      PdxSchemaField<SchemaOrder, int16_t, &SchemaOrder::quantity_>,
+      PdxSchemaField<SchemaOrder, std::vector<std::string>,
+                     &SchemaOrder::tags_>,
+      PdxSchemaField<SchemaOrder, double, &SchemaOrder::price_>>
+      PdxFields;
+
+  static const std::vector<std::string>& pdxFieldNames() {
+    static const std::vector<std::string> names{"id", "name", "quantity",
+                                                "tags", "price"};
+    return names;
+  }
+
+  static std::shared_ptr<PdxSerializable> create() {
+    return std::make_shared<SchemaOrder>();
+  }
+
+  const std::string& getClassName() const override {
+    static const std::string className = "SchemaOrder";
+    return className;
+  }
+};
+
+class PdxSchemaTest : public ::testing::Test {
+ protected:
+  PdxSchemaTest()
+      : cache_(CacheFactory().set("log-level", "none").create()),
+        cacheImpl_(CacheRegionHelper::getCacheImpl(&cache_)) {
+    cache_.getTypeRegistry().registerPdxType(SchemaOrder::create);
+  }
+
+  ~PdxSchemaTest() noexcept override { cache_.close(); }
+
+  std::shared_ptr<SchemaOrder> createOrder(size_t nameLength) {
+    auto order = std::make_shared<SchemaOrder>();
+    order->id_ = 42;
+    order->name_ = std::string(nameLength, 'n');
+    order->quantity_ = 7;
+    order->tags_ = {"red", "blue"};
+    order->price_ = 9.5;
+    return order;
+  }
+
+  // Registers the local type the same way the first serialization would,
+  // without needing a server to hand out the type id.
+  void registerLocalType(const SchemaOrder& order) {
+    auto pdxTypeRegistry = cacheImpl_->getPdxTypeRegistry();
+    auto output = cacheImpl_->createDataOutput();
+    PdxWriterWithTypeCollector writer(output, order.getClassName(),
+                                      pdxTypeRegistry);
+    order.toData(writer);
+    auto pdxType = writer.getPdxLocalType();
+    pdxType->InitializeType();
+    pdxType->setTypeId(1);
+    pdxType->setLocal(true);
+    pdxTypeRegistry->addLocalPdxType(order.getClassName(), pdxType);
+    pdxTypeRegistry->addPdxType(1, pdxType);
+  }
+
+  std::vector<uint8_t> writeWithPdxWriter(const SchemaOrder& order) {
+    auto pdxTypeRegistry = cacheImpl_->getPdxTypeRegistry();
+    auto output = cacheImpl_->createDataOutput();
+    PdxLocalWriter writer(output, pdxTypeRegistry->getPdxType(1),
+                          pdxTypeRegistry);
+    order.toData(writer);
+    writer.endObjectWriting();
+    return std::vector<uint8_t>(output.getBuffer(),
+                                output.getBuffer() + output.getBufferLength());
+  }
+
+  void expectSameBytes(size_t nameLength) {
+    auto order = createOrder(nameLength);
+    registerLocalType(*order);
+
+    auto output = cacheImpl_->createDataOutput();
+    output.writeObject(order);
+
+    // skip the PDX DSCode written ahead of the PDX header
+    std::vector<uint8_t> actual(output.getBuffer() + 1,
+                                output.getBuffer() + output.getBufferLength());
+    EXPECT_EQ(writeWithPdxWriter(*order), actual);
+  }
+
+  Cache cache_;
+  CacheImpl* cacheImpl_;
+};
+
+TEST_F(PdxSchemaTest, serializedBytesMatchPdxWriterWithOneByteOffsets) {
+  expectSameBytes(10);
+}
+
+TEST_F(PdxSchemaTest, serializedBytesMatchPdxWriterWithTwoByteOffsets) {
+  expectSameBytes(1000);
+}
+
+TEST_F(PdxSchemaTest, serializedBytesMatchPdxWriterWithFourByteOffsets) {
+  expectSameBytes(70000);
+}
+
+TEST_F(PdxSchemaTest, roundTripsThroughDataInput) {
+  auto order = createOrder(10);
+  registerLocalType(*order);
+
+  auto output = cacheImpl_->createDataOutput();
+  output.writeObject(order);
+  output.writeInt(static_cast<int32_t>(0x7fabcdef));
+
+  auto input = cacheImpl_->createDataInput(output.getBuffer(),
+                                           output.getBufferLength());
+  std::shared_ptr<Serializable> object;
+  input.readObject(object);
+  auto actual = std::dynamic_pointer_cast<SchemaOrder>(object);
+  ASSERT_NE(nullptr, actual);
+  EXPECT_EQ(order->id_, actual->id_);
+  EXPECT_EQ(order->name_, actual->name_);
+  EXPECT_EQ(order->quantity_, actual->quantity_);
+  EXPECT_EQ(order->tags_, actual->tags_);
+  EXPECT_EQ(order->price_, actual->price_);
+  EXPECT_EQ(0x7fabcdef, input.readInt32());
+}
+
+}  // namespace
@@ -276,4 +276,66 @@ TEST_F(PdxTypeTest, testDeserializeNoJavaPdxType) {
   EXPECT_EQ(pdx_expected, *pdx_type);
 }
 
+TEST_F(PdxTypeTest, testGetFieldPositions) {
+  PdxTypeRegistry pdx_type_registry{nullptr};
+  PdxType pdx_type{pdx_type_registry, gemfireJsonClassName, false};
+
+  pdx_type.addFixedLengthTypeField("a", "", PdxFieldTypes::INT,
+                                   PdxTypes::INTEGER_SIZE);
+  pdx_type.addVariableLengthTypeField("b", "", PdxFieldTypes::STRING);
+  pdx_type.addFixedLengthTypeField("c", "", PdxFieldTypes::INT,
+                                   PdxTypes::INTEGER_SIZE);
+  pdx_type.addVariableLengthTypeField("d", "", PdxFieldTypes::STRING);
+  pdx_type.addFixedLengthTypeField("e", "", PdxFieldTypes::LONG,
+                                   PdxTypes::LONG_SIZE);
+  pdx_type.InitializeType();
+
+  // 24 bytes of fields followed by a one byte offset for field "d"
+  std::vector<uint8_t> pdx_stream(25, 0);
+  pdx_stream[24] = 11;
+
+  std::vector<int32_t> positions;
+  pdx_type.getFieldPositions(pdx_stream.data(),
+                             static_cast<int32_t>(pdx_stream.size()),
+                             positions);
+
+  EXPECT_EQ((std::vector<int32_t>{0, 4, 7, 11, 16, 24}), positions);
+  for (int32_t i = 0; i < pdx_type.getTotalFields(); i++) {
+    EXPECT_EQ(positions[i],
+              pdx_type.getFieldPosition(i, pdx_stream.data() + 24, 1, 24));
+  }
+}
+
+TEST_F(PdxTypeTest, testIdentityPdxFieldsAreSortedByName) {
+  PdxTypeRegistry pdx_type_registry{nullptr};
+  PdxType pdx_type{pdx_type_registry, gemfireJsonClassName, false};
+
+  pdx_type.addVariableLengthTypeField("foo", "", PdxFieldTypes::STRING);
+  pdx_type.addVariableLengthTypeField("alice", "", PdxFieldTypes::STRING);
+  pdx_type.addFixedLengthTypeField("bar", "", PdxFieldTypes::BOOLEAN,
+                                   PdxTypes::BOOLEAN_SIZE);
+  pdx_type.InitializeType();
+
+  auto&& identityFields = pdx_type.getIdentityPdxFields();
+  ASSERT_EQ(3u, identityFields.size());
+  EXPECT_EQ("alice", identityFields[0]->getFieldName());
+  EXPECT_EQ("bar", identityFields[1]->getFieldName());
+  EXPECT_EQ("foo", identityFields[2]->getFieldName());
+}
+
+TEST_F(PdxTypeTest, testMarkedIdentityPdxFields) {
+  PdxTypeRegistry pdx_type_registry{nullptr};
+  PdxType pdx_type{pdx_type_registry, gemfireJsonClassName, false};
+
+  pdx_type.addVariableLengthTypeField("foo", "", PdxFieldTypes::STRING);
+  pdx_type.addVariableLengthTypeField("alice", "", PdxFieldTypes::STRING);
+  pdx_type.getPdxField("foo")->setIdentityField(true);
+  pdx_type.InitializeType();
+  // re-initializing a type in use leaves its field layout alone
+  pdx_type.InitializeType();
+
+  ASSERT_EQ(1u, pdx_type.getIdentityPdxFields().size());
+  EXPECT_EQ("foo", pdx_type.getIdentityPdxFields()[0]->getFieldName());
+}
+
 }  // namespace
@@ -19,8 +19,11 @@
 
 #include <geode/RegionAttributesFactory.hpp>
 
+using apache::geode::client::DiskPolicyType;
 using apache::geode::client::ExpirationAction;
+using apache::geode::client::IllegalStateException;
 using apache::geode::client::RegionAttributesFactory;
+using apache::geode::client::ValueStorageType;
 
 TEST(RegionAttributesFactoryTest, setEntryIdleTimeoutSeconds) {
   RegionAttributesFactory regionAttributesFactory;
@@ -77,3 +80,22 @@ TEST(RegionAttributesFactoryTest, setLruEntriesLimit) {
                               .create();
   EXPECT_EQ(regionAttributes.getLruEntriesLimit(), 2u);
 }
+
+TEST(RegionAttributesFactoryTest, setValueStorage) {
+  RegionAttributesFactory regionAttributesFactory;
+  auto regionAttributes = regionAttributesFactory
+                              .setValueStorage(ValueStorageType::COMPRESSED)
+                              .setDeserializedValueCacheSize(10)
+                              .create();
+  EXPECT_EQ(ValueStorageType::COMPRESSED, regionAttributes.getValueStorage());
+  EXPECT_EQ(10u, regionAttributes.getDeserializedValueCacheSize());
+}
+
+TEST(RegionAttributesFactoryTest, serializedValueStorageWithOverflowThrows) {
+  RegionAttributesFactory regionAttributesFactory;
+  regionAttributesFactory.setValueStorage(ValueStorageType::SERIALIZED)
+      .setDiskPolicy(DiskPolicyType::OVERFLOWS)
+      .setLruEntriesLimit(10)
+      .setPersistenceManager("lib", "factory");
+  EXPECT_THROW(regionAttributesFactory.create(), IllegalStateException);
+}
@@ -0,0 +1,175 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <geode/CacheableBuiltins.hpp>
+#include <geode/CacheableString.hpp>
+#include <geode/ExceptionTypes.hpp>
+#include <geode/Struct.hpp>
+
+#include "RemoteSelectResultsStream.hpp"
+
+namespace {
+
+using apache::geode::client::CacheableInt32;
+using apache::geode::client::CacheableString;
+using apache::geode::client::IllegalStateException;
+using apache::geode::client::QueryException;
+using apache::geode::client::RemoteSelectResultsStream;
+using apache::geode::client::Serializable;
+using apache::geode::client::Struct;
+
+std::vector<std::shared_ptr<Serializable>> ints(int32_t from, int32_t to) {
+  std::vector<std::shared_ptr<Serializable>> values;
+  for (auto i = from; i < to; i++) {
+    values.push_back(CacheableInt32::create(i));
+  }
+  return values;
+}
+
+int32_t intValue(const std::shared_ptr<Serializable>& value) {
+  return std::dynamic_pointer_cast<CacheableInt32>(value)->value();
+}
+
+TEST(RemoteSelectResultsStreamTest, returnsValuesInChunkOrder) {
+  RemoteSelectResultsStream stream;
+  stream.start([&stream] {
+    stream.push(ints(0, 3), {});
+    stream.push(ints(3, 5), {});
+  });
+
+  std::shared_ptr<Serializable> result;
+  for (int32_t i = 0; i < 5; i++) {
+    ASSERT_TRUE(stream.next(result));
+    EXPECT_EQ(i, intValue(result));
+  }
+  EXPECT_FALSE(stream.next(result));
+}
+
+TEST(RemoteSelectResultsStreamTest, groupsStructFields) {
+  RemoteSelectResultsStream stream;
+  stream.start([&stream] {
+    stream.push({CacheableString::create("a"), CacheableInt32::create(1),
+                 CacheableString::create("b"), CacheableInt32::create(2)},
+                {"name", "id"});
+  });
+
+  std::shared_ptr<Serializable> result;
+  ASSERT_TRUE(stream.next(result));
+  auto first = std::dynamic_pointer_cast<Struct>(result);
+  ASSERT_NE(nullptr, first);
+  EXPECT_EQ(1, intValue((*first)["id"]));
+  EXPECT_EQ("name", first->getFieldName(0));
+
+  ASSERT_TRUE(stream.next(result));
+  auto second = std::dynamic_pointer_cast<Struct>(result);
+  ASSERT_NE(nullptr, second);
+  EXPECT_EQ(2, intValue((*second)["id"]));
+  EXPECT_FALSE(stream.next(result));
+}
+
+TEST(RemoteSelectResultsStreamTest, structOutlivesStream) {
+  std::shared_ptr<Struct> row;
+  {
+    RemoteSelectResultsStream stream;
+    stream.start([&stream] {
+      stream.push({CacheableString::create("a"), CacheableInt32::create(1)},
+                  {"name", "id"});
+    });
+
+    std::shared_ptr<Serializable> result;
+    ASSERT_TRUE(stream.next(result));
+    row = std::dynamic_pointer_cast<Struct>(result);
+    ASSERT_NE(nullptr, row);
+  }
+
+  EXPECT_EQ(1, intValue((*row)["id"]));
+  EXPECT_EQ("name", row->getFieldName(0));
+  EXPECT_EQ(1, row->getStructSet()->getFieldIndex("id"));
+}
+
+TEST(RemoteSelectResultsStreamTest, firstResultIsAvailableBeforeQueryEnds) {
+  RemoteSelectResultsStream stream;
+  std::atomic<bool> finished(false);
+  stream.start([&stream, &finished] {
+    for (int32_t i = 0; i < 100; i++) {
+      stream.push(ints(i, i + 1), {});
+    }
+    finished = true;
+  });
+
+  std::shared_ptr<Serializable> result;
+  ASSERT_TRUE(stream.next(result));
+  EXPECT_EQ(0, intValue(result));
+  EXPECT_FALSE(finished);
+
+  int32_t count = 1;
+  while (stream.next(result)) {
+    EXPECT_EQ(count++, intValue(result));
+  }
+  EXPECT_EQ(100, count);
+  EXPECT_TRUE(finished);
+}
+
+TEST(RemoteSelectResultsStreamTest, rethrowsQueryErrorAfterResults) {
+  RemoteSelectResultsStream stream;
+  stream.start([&stream] {
+    stream.push(ints(0, 1), {});
+    throw QueryException("query failed");
+  });
+
+  std::shared_ptr<Serializable> result;
+  ASSERT_TRUE(stream.next(result));
+  EXPECT_THROW(stream.next(result), QueryException);
+}
+
+TEST(RemoteSelectResultsStreamTest, restartFailsOnceResultsWereRead) {
+  RemoteSelectResultsStream stream;
+  std::atomic<bool> read(false);
+  stream.start([&stream, &read] {
+    stream.push(ints(0, 1), {});
+    while (!read) {
+      std::this_thread::yield();
+    }
+    stream.restart();
+  });
+
+  std::shared_ptr<Serializable> result;
+  ASSERT_TRUE(stream.next(result));
+  read = true;
+  EXPECT_THROW(stream.next(result), IllegalStateException);
+}
+
+TEST(RemoteSelectResultsStreamTest, destroyingUnreadStreamDoesNotBlock) {
+  std::atomic<int32_t> pushed(0);
+  {
+    RemoteSelectResultsStream stream;
+    stream.start([&stream, &pushed] {
+      for (int32_t i = 0; i < 100; i++) {
+        stream.push(ints(i, i + 1), {});
+        pushed++;
+      }
+    });
+  }
+  EXPECT_EQ(100, pushed);
+}
+
+}  // namespace
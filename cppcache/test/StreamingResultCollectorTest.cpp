@@ -0,0 +1,226 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <geode/CacheableBuiltins.hpp>
+#include <geode/ExceptionTypes.hpp>
+#include <geode/StreamingResultCollector.hpp>
+
+namespace {
+
+using apache::geode::client::Cacheable;
+using apache::geode::client::CacheableInt32;
+using apache::geode::client::FunctionExecutionException;
+using apache::geode::client::StreamingResultCollector;
+
+const int32_t PRODUCERS = 4;
+const int32_t RESULTS_PER_PRODUCER = 10000;
+
+int32_t intValue(const std::shared_ptr<Cacheable>& value) {
+  return std::dynamic_pointer_cast<CacheableInt32>(value)->value();
+}
+
+// Adds results the way one thread per server would, each encoding its
+// producer and sequence number.
+std::vector<std::thread> startProducers(StreamingResultCollector& rc) {
+  std::vector<std::thread> producers;
+  for (int32_t p = 0; p < PRODUCERS; p++) {
+    producers.emplace_back([&rc, p] {
+      for (int32_t i = 0; i < RESULTS_PER_PRODUCER; i++) {
+        rc.addResult(CacheableInt32::create(p * RESULTS_PER_PRODUCER + i));
+      }
+    });
+  }
+  return producers;
+}
+
+void joinAndEnd(std::vector<std::thread>& producers,
+                StreamingResultCollector& rc) {
+  for (auto& producer : producers) {
+    producer.join();
+  }
+  rc.endResults();
+}
+
+TEST(StreamingResultCollectorTest, returnsResultsBeforeEnd) {
+  StreamingResultCollector rc;
+  rc.addResult(CacheableInt32::create(1));
+  rc.addResult(nullptr);
+
+  std::shared_ptr<Cacheable> result;
+  ASSERT_TRUE(rc.next(result));
+  EXPECT_EQ(1, intValue(result));
+  ASSERT_TRUE(rc.next(result));
+  EXPECT_EQ(nullptr, result);
+
+  rc.endResults();
+  EXPECT_FALSE(rc.next(result));
+}
+
+TEST(StreamingResultCollectorTest, keepsOrderOfEachProducer) {
+  StreamingResultCollector rc;
+  std::thread execution([&rc] {
+    auto producers = startProducers(rc);
+    joinAndEnd(producers, rc);
+  });
+
+  std::vector<int32_t> last(PRODUCERS, -1);
+  int32_t count = 0;
+  std::shared_ptr<Cacheable> result;
+  while (rc.next(result)) {
+    auto value = intValue(result);
+    auto producer = value / RESULTS_PER_PRODUCER;
+    EXPECT_LT(last[producer], value);
+    last[producer] = value;
+    count++;
+  }
+  execution.join();
+
+  EXPECT_EQ(PRODUCERS * RESULTS_PER_PRODUCER, count);
+}
+
+TEST(StreamingResultCollectorTest, throttlesProducersAtCapacity) {
+  StreamingResultCollector rc(16);
+  std::atomic<int32_t> added(0);
+  std::thread producer([&rc, &added] {
+    for (int32_t i = 0; i < 100; i++) {
+      rc.addResult(CacheableInt32::create(i));
+      added++;
+    }
+    rc.endResults();
+  });
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  EXPECT_EQ(16, added);
+
+  int32_t expected = 0;
+  std::shared_ptr<Cacheable> result;
+  while (rc.next(result)) {
+    EXPECT_EQ(expected++, intValue(result));
+  }
+  producer.join();
+
+  EXPECT_EQ(100, expected);
+}
+
+TEST(StreamingResultCollectorTest, getResultReturnsRemainingResults) {
+  StreamingResultCollector rc(64);
+  std::thread execution([&rc] {
+    auto producers = startProducers(rc);
+    joinAndEnd(producers, rc);
+  });
+
+  std::shared_ptr<Cacheable> result;
+  ASSERT_TRUE(rc.next(result));
+  auto results = rc.getResult();
+  execution.join();
+
+  EXPECT_EQ(static_cast<size_t>(PRODUCERS * RESULTS_PER_PRODUCER - 1),
+            results->size());
+  EXPECT_EQ(results, rc.getResult());
+}
+
+TEST(StreamingResultCollectorTest, clearResultsDiscardsUnconsumedResults) {
+  StreamingResultCollector rc;
+  rc.addResult(CacheableInt32::create(1));
+  rc.addResult(CacheableInt32::create(2));
+  rc.clearResults();
+  rc.addResult(CacheableInt32::create(3));
+  rc.endResults();
+
+  auto results = rc.getResult();
+  ASSERT_EQ(1u, results->size());
+  EXPECT_EQ(3, intValue(results->at(0)));
+}
+
+TEST(StreamingResultCollectorTest, clearResultsAfterNextFailsCollector) {
+  StreamingResultCollector rc;
+  rc.addResult(CacheableInt32::create(1));
+  rc.addResult(CacheableInt32::create(2));
+
+  std::shared_ptr<Cacheable> result;
+  ASSERT_TRUE(rc.next(result));
+  EXPECT_THROW(rc.clearResults(), FunctionExecutionException);
+
+  rc.addResult(CacheableInt32::create(1));
+  rc.endResults();
+  EXPECT_THROW(rc.next(result), FunctionExecutionException);
+  EXPECT_THROW(rc.getResult(), FunctionExecutionException);
+}
+
+TEST(StreamingResultCollectorTest, failedCollectorReleasesWaitingProducer) {
+  StreamingResultCollector rc(1);
+  rc.addResult(CacheableInt32::create(1));
+
+  std::shared_ptr<Cacheable> result;
+  ASSERT_TRUE(rc.next(result));
+
+  std::atomic<int32_t> added(0);
+  std::thread producer([&rc, &added] {
+    for (int32_t i = 0; i < 3; i++) {
+      rc.addResult(CacheableInt32::create(i));
+      added++;
+    }
+  });
+  while (added < 1) {
+    std::this_thread::yield();
+  }
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+  EXPECT_THROW(rc.clearResults(), FunctionExecutionException);
+  producer.join();
+  EXPECT_EQ(3, added);
+}
+
+TEST(StreamingResultCollectorTest, clearResultsWhileConsumerWaits) {
+  StreamingResultCollector rc;
+  std::atomic<bool> waiting(false);
+  std::vector<int32_t> consumed;
+  std::thread consumer([&] {
+    std::shared_ptr<Cacheable> result;
+    waiting = true;
+    while (rc.next(result)) {
+      consumed.push_back(intValue(result));
+    }
+  });
+  while (!waiting) {
+    std::this_thread::yield();
+  }
+
+  rc.clearResults();
+  rc.addResult(CacheableInt32::create(1));
+  rc.endResults();
+  consumer.join();
+
+  EXPECT_EQ(std::vector<int32_t>{1}, consumed);
+}
+
+TEST(StreamingResultCollectorTest, throwsIfNoResultArrivesInTime) {
+  StreamingResultCollector rc;
+  std::shared_ptr<Cacheable> result;
+  EXPECT_THROW(rc.next(result, std::chrono::milliseconds(10)),
+               FunctionExecutionException);
+  EXPECT_THROW(rc.getResult(std::chrono::milliseconds(10)),
+               FunctionExecutionException);
+}
+
+}  // namespace
@@ -0,0 +1,130 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#if defined(__linux__)
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "SubscriptionReactor.hpp"
+
+using apache::geode::client::SubscriptionReactor;
+
+/**
+ * One end of a socket pair watched by a reactor, receiving one byte per
+ * message.
+ */
+class ReactorChannel {
+ public:
+  explicit ReactorChannel(SubscriptionReactor& reactor)
+      : received_(0), concurrent_(0), overlapped_(false) {
+    EXPECT_EQ(0, ::socketpair(AF_UNIX, SOCK_STREAM, 0, sockets_));
+    receiver_ = reactor.createReceiver(
+        sockets_[0],
+        [this](std::atomic<bool>&) {
+          if (++concurrent_ > 1) {
+            overlapped_ = true;
+          }
+          char byte;
+          auto result = ::read(sockets_[0], &byte, 1);
+          --concurrent_;
+
+          std::lock_guard<decltype(mutex_)> lock(mutex_);
+          if (result == 1) {
+            ++received_;
+          }
+          condition_.notify_all();
+          return result == 1;
+        },
+        [] { return false; });
+  }
+
+  ~ReactorChannel() {
+    receiver_ = nullptr;
+    ::close(sockets_[0]);
+    ::close(sockets_[1]);
+  }
+
+  void send(size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+      char byte = 0;
+      EXPECT_EQ(1, ::write(sockets_[1], &byte, 1));
+    }
+  }
+
+  bool waitForReceived(size_t count) {
+    std::unique_lock<decltype(mutex_)> lock(mutex_);
+    return condition_.wait_for(lock, std::chrono::seconds(10),
+                               [&] { return received_ >= count; });
+  }
+
+  size_t received() {
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+    return received_;
+  }
+
+  int sockets_[2];
+  std::unique_ptr<apache::geode::client::NotificationReceiver> receiver_;
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  size_t received_;
+  std::atomic<int> concurrent_;
+  std::atomic<bool> overlapped_;
+};
+
+TEST(SubscriptionReactorTest, receivesFromManyChannelsOnFewThreads) {
+  SubscriptionReactor reactor(2);
+  std::vector<std::unique_ptr<ReactorChannel>> channels;
+  for (auto i = 0; i < 16; ++i) {
+    channels.emplace_back(new ReactorChannel(reactor));
+    channels.back()->receiver_->start();
+  }
+
+  for (auto& channel : channels) {
+    channel->send(100);
+  }
+  for (auto& channel : channels) {
+    EXPECT_TRUE(channel->waitForReceived(100));
+    EXPECT_FALSE(channel->overlapped_);
+  }
+}
+
+TEST(SubscriptionReactorTest, stoppedChannelReceivesNoMore) {
+  SubscriptionReactor reactor(1);
+  ReactorChannel channel(reactor);
+  channel.receiver_->start();
+
+  channel.send(1);
+  EXPECT_TRUE(channel.waitForReceived(1));
+
+  channel.receiver_->stopNoblock();
+  channel.receiver_->wait();
+  channel.send(1);
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  EXPECT_EQ(1u, channel.received());
+}
+
+#endif
@@ -0,0 +1,256 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <gmock/gmock.h>
+
+#include <gtest/gtest.h>
+
+#include "ThreadAffineConnections.hpp"
+
+using ::testing::ElementsAre;
+using ::testing::Eq;
+using ::testing::IsEmpty;
+using ::testing::IsNull;
+using ::testing::UnorderedElementsAre;
+
+using apache::geode::client::ThreadAffineConnections;
+
+namespace {
+
+struct TestConnection {
+  explicit TestConnection(int partition) : partition(partition) {}
+  const int partition;
+};
+
+class ThreadAffineConnectionsTest : public ::testing::Test {
+ protected:
+  static const void* partition(int p) {
+    return reinterpret_cast<const void*>(static_cast<intptr_t>(p));
+  }
+
+  void put(TestConnection* conn) {
+    cache_.put(partition(conn->partition), conn,
+               [this](TestConnection* c) { released_.push_back(c); });
+  }
+
+  ThreadAffineConnections<TestConnection> cache_;
+  std::vector<TestConnection*> released_;
+};
+
+TEST_F(ThreadAffineConnectionsTest, takeOnEmptyReturnsNull) {
+  EXPECT_THAT(cache_.take(partition(1)), IsNull());
+}
+
+TEST_F(ThreadAffineConnectionsTest, takeReturnsConnectionOfPartition) {
+  TestConnection one(1), two(2);
+  put(&one);
+  put(&two);
+
+  EXPECT_THAT(cache_.take(partition(1)), Eq(&one));
+  EXPECT_THAT(cache_.take(partition(1)), IsNull());
+  EXPECT_THAT(cache_.take(partition(2)), Eq(&two));
+  EXPECT_THAT(released_, IsEmpty());
+}
+
+TEST_F(ThreadAffineConnectionsTest, putKeepsOneConnectionPerPartition) {
+  TestConnection one(1), another(1), two(2);
+  put(&one);
+  put(&two);
+  put(&another);
+
+  EXPECT_THAT(released_, ElementsAre(&one));
+  EXPECT_THAT(cache_.take(partition(1)), Eq(&another));
+  EXPECT_THAT(cache_.take(partition(1)), IsNull());
+  EXPECT_THAT(cache_.take(partition(2)), Eq(&two));
+}
+
+TEST_F(ThreadAffineConnectionsTest, putReusesSlotOfTakenPartition) {
+  std::vector<TestConnection> conns;
+  for (int i = 1; i <= static_cast<int>(cache_.SLOTS_PER_THREAD); i++) {
+    conns.emplace_back(i);
+  }
+  for (auto& conn : conns) {
+    put(&conn);
+  }
+
+  auto taken = cache_.take(partition(1));
+  put(taken);
+
+  EXPECT_THAT(released_, IsEmpty());
+  for (int i = 1; i <= static_cast<int>(cache_.SLOTS_PER_THREAD); i++) {
+    EXPECT_THAT(cache_.take(partition(i)), Eq(&conns[i - 1]));
+  }
+}
+
+TEST_F(ThreadAffineConnectionsTest, putEvictsLeastRecentlyCached) {
+  std::vector<TestConnection> conns;
+  for (int i = 1; i <= static_cast<int>(cache_.SLOTS_PER_THREAD) + 1; i++) {
+    conns.emplace_back(i);
+  }
+  for (auto& conn : conns) {
+    put(&conn);
+  }
+
+  EXPECT_THAT(released_, ElementsAre(&conns[0]));
+  EXPECT_THAT(cache_.take(partition(1)), IsNull());
+  EXPECT_THAT(cache_.take(partition(2)), Eq(&conns[1]));
+}
+
+TEST_F(ThreadAffineConnectionsTest, otherThreadsDoNotSeeConnection) {
+  TestConnection one(1);
+  put(&one);
+
+  TestConnection* taken = &one;
+  std::thread other([&] { taken = cache_.take(partition(1)); });
+  other.join();
+
+  EXPECT_THAT(taken, IsNull());
+  EXPECT_THAT(cache_.take(partition(1)), Eq(&one));
+}
+
+TEST_F(ThreadAffineConnectionsTest, reclaimReleasesMatchingConnections) {
+  TestConnection one(1), two(2);
+  put(&one);
+  put(&two);
+
+  cache_.reclaim([](TestConnection* c) { return c->partition == 2; },
+                 [this](TestConnection* c) { released_.push_back(c); });
+
+  EXPECT_THAT(released_, ElementsAre(&two));
+  EXPECT_THAT(cache_.take(partition(2)), IsNull());
+  EXPECT_THAT(cache_.take(partition(1)), Eq(&one));
+}
+
+TEST_F(ThreadAffineConnectionsTest, reclaimReleasesConnectionsOfExitedThread) {
+  TestConnection one(1), two(2);
+  put(&one);
+  std::thread other([&] { put(&two); });
+  other.join();
+
+  cache_.reclaim([](TestConnection*) { return false; },
+                 [this](TestConnection* c) { released_.push_back(c); });
+
+  EXPECT_THAT(released_, ElementsAre(&two));
+  EXPECT_THAT(cache_.take(partition(1)), Eq(&one));
+}
+
+TEST_F(ThreadAffineConnectionsTest, closeReleasesAllAndStopsCaching) {
+  TestConnection one(1), two(2), three(3);
+  put(&one);
+  std::thread other([&] { put(&two); });
+  other.join();
+
+  cache_.close([this](TestConnection* c) { released_.push_back(c); });
+  EXPECT_THAT(released_, UnorderedElementsAre(&one, &two));
+
+  put(&three);
+  EXPECT_THAT(released_, UnorderedElementsAre(&one, &two, &three));
+  EXPECT_THAT(cache_.take(partition(3)), IsNull());
+}
+
+TEST_F(ThreadAffineConnectionsTest, concurrentReclaimNeverLosesConnection) {
+  std::vector<TestConnection> conns;
+  for (int i = 1; i <= 4; i++) {
+    conns.emplace_back(i);
+  }
+
+  std::mutex mutex;
+  std::vector<TestConnection*> pool;
+  for (auto& conn : conns) {
+    pool.push_back(&conn);
+  }
+  auto release = [&](TestConnection* c) {
+    std::lock_guard<std::mutex> lock(mutex);
+    pool.push_back(c);
+  };
+
+  std::atomic<bool> done(false);
+  std::thread reclaimer([&] {
+    while (!done) {
+      cache_.reclaim([](TestConnection*) { return true; }, release);
+    }
+  });
+
+  for (int i = 0; i < 100000; i++) {
+    auto conn = cache_.take(partition(i % 4 + 1));
+    if (!conn) {
+      std::lock_guard<std::mutex> lock(mutex);
+      if (!pool.empty()) {
+        conn = pool.back();
+        pool.pop_back();
+      }
+    }
+    if (conn) {
+      cache_.put(partition(conn->partition), conn, release);
+    }
+  }
+  done = true;
+  reclaimer.join();
+  cache_.reclaim([](TestConnection*) { return true; }, release);
+
+  EXPECT_THAT(pool, UnorderedElementsAre(&conns[0], &conns[1], &conns[2],
+                                         &conns[3]));
+}
+
+TEST_F(ThreadAffineConnectionsTest, reclaimKeepsConnectionsInTheirPartition) {
+  std::vector<TestConnection> conns;
+  for (int i = 1; i <= static_cast<int>(cache_.SLOTS_PER_THREAD) + 1; i++) {
+    conns.emplace_back(i);
+  }
+  for (int i = 0; i < static_cast<int>(cache_.SLOTS_PER_THREAD); i++) {
+    put(&conns[i]);
+  }
+
+  // while reclaim looks at the connection of partition 1, this thread files
+  // its slot under another partition and empties it again
+  std::atomic<int> step(0);
+  std::thread reclaimer([&] {
+    cache_.reclaim(
+        [&](TestConnection* c) {
+          if (c->partition == 1) {
+            step = 1;
+            while (step != 2) {
+              std::this_thread::yield();
+            }
+          }
+          return false;
+        },
+        [this](TestConnection* c) { released_.push_back(c); });
+  });
+  while (step != 1) {
+    std::this_thread::yield();
+  }
+  auto& other = conns.back();
+  put(&other);
+  EXPECT_THAT(cache_.take(partition(other.partition)), Eq(&other));
+  step = 2;
+  reclaimer.join();
+
+  EXPECT_THAT(released_, ElementsAre(&conns[0]));
+  EXPECT_THAT(cache_.take(partition(other.partition)), IsNull());
+  EXPECT_THAT(cache_.take(partition(1)), IsNull());
+  for (int i = 2; i <= static_cast<int>(cache_.SLOTS_PER_THREAD); i++) {
+    EXPECT_THAT(cache_.take(partition(i)), Eq(&conns[i - 1]));
+  }
+}
+
+}  // namespace
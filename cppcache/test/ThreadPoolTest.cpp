@@ -19,14 +19,17 @@
 #include <chrono>
 #include <condition_variable>
 #include <deque>
+#include <functional>
 #include <mutex>
 #include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 
 #include "ThreadPool.hpp"
 
 using apache::geode::client::Callable;
+using apache::geode::client::PooledWork;
 using apache::geode::client::ThreadPool;
 
 class TestCallable : public Callable {
@@ -54,3 +57,156 @@ TEST(ThreadPoolTest, callableIsCalled) {
 
   ASSERT_EQ(1, c->called_);
 }
+
+class Latch {
+ public:
+  Latch() : open_(false) {}
+
+  void open() {
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+    open_ = true;
+    condition_.notify_all();
+  }
+
+  bool waitFor(std::chrono::milliseconds timeout) {
+    std::unique_lock<decltype(mutex_)> lock(mutex_);
+    return condition_.wait_for(lock, timeout, [this] { return open_; });
+  }
+
+ private:
+  bool open_;
+  std::mutex mutex_;
+  std::condition_variable condition_;
+};
+
+class FunctionCallable : public Callable {
+ public:
+  explicit FunctionCallable(std::function<void()> function)
+      : function_(std::move(function)) {}
+
+  void call() override { function_(); }
+
+ private:
+  std::function<void()> function_;
+};
+
+class ThreadIdWork : public PooledWork<std::thread::id> {
+ protected:
+  std::thread::id execute() override { return std::this_thread::get_id(); }
+};
+
+class BlockingWork : public PooledWork<std::thread::id> {
+ public:
+  Latch started_;
+  Latch release_;
+
+ protected:
+  std::thread::id execute() override {
+    started_.open();
+    release_.waitFor(std::chrono::seconds(10));
+    return std::this_thread::get_id();
+  }
+};
+
+TEST(ThreadPoolTest, allCallablesAreCalled) {
+  ThreadPool threadPool(4);
+
+  auto c = std::make_shared<TestCallable>();
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; i++) {
+    threads.emplace_back([&threadPool, &c] {
+      for (int j = 0; j < 1000; j++) {
+        threadPool.perform(c);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  std::unique_lock<decltype(c->mutex_)> lock(c->mutex_);
+  c->condition_.wait(lock, [&] { return c->called_ == 4000; });
+}
+
+TEST(ThreadPoolTest, idleThreadStealsWorkOfBusyThread) {
+  ThreadPool threadPool(2);
+
+  Latch inner;
+  Latch outer;
+  threadPool.perform(std::make_shared<FunctionCallable>([&] {
+    // queued on this pool thread, which stays busy until it has run
+    threadPool.perform(std::make_shared<FunctionCallable>([&] {
+      inner.open();
+    }));
+    if (inner.waitFor(std::chrono::seconds(10))) {
+      outer.open();
+    }
+  }));
+
+  EXPECT_TRUE(outer.waitFor(std::chrono::seconds(10)));
+}
+
+TEST(ThreadPoolTest, getResultOnPoolThreadRunsWorkNotYetStarted) {
+  ThreadPool threadPool(1);
+
+  Latch done;
+  bool ranInline = false;
+  threadPool.perform(std::make_shared<FunctionCallable>([&] {
+    // queued behind this work on the only pool thread
+    auto work = std::make_shared<ThreadIdWork>();
+    threadPool.perform(work);
+    ranInline = work->getResult() == std::this_thread::get_id() &&
+                work->getResult() == std::this_thread::get_id();
+    done.open();
+  }));
+
+  ASSERT_TRUE(done.waitFor(std::chrono::seconds(10)));
+  EXPECT_TRUE(ranInline);
+}
+
+TEST(ThreadPoolTest, getResultOnApplicationThreadWaitsForPool) {
+  ThreadPool threadPool(1);
+
+  Latch busy;
+  threadPool.perform(std::make_shared<FunctionCallable>(
+      [&busy] { busy.waitFor(std::chrono::seconds(10)); }));
+
+  auto work = std::make_shared<ThreadIdWork>();
+  threadPool.perform(work);
+
+  std::thread release([&busy] {
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    busy.open();
+  });
+  EXPECT_NE(std::this_thread::get_id(), work->getResult());
+  release.join();
+}
+
+TEST(ThreadPoolTest, runOrGetResultOnApplicationThreadRunsWorkNotYetStarted) {
+  ThreadPool threadPool(1);
+
+  Latch busy;
+  threadPool.perform(std::make_shared<FunctionCallable>(
+      [&busy] { busy.waitFor(std::chrono::seconds(10)); }));
+
+  auto work = std::make_shared<ThreadIdWork>();
+  threadPool.perform(work);
+
+  EXPECT_EQ(std::this_thread::get_id(), work->runOrGetResult());
+  busy.open();
+}
+
+TEST(ThreadPoolTest, getResultWaitsForWorkStartedByPool) {
+  ThreadPool threadPool(1);
+
+  auto work = std::make_shared<BlockingWork>();
+  threadPool.perform(work);
+  ASSERT_TRUE(work->started_.waitFor(std::chrono::seconds(10)));
+
+  std::thread release([&work] {
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    work->release_.open();
+  });
+  EXPECT_NE(std::this_thread::get_id(), work->getResult());
+  release.join();
+}
@@ -15,14 +15,18 @@
  * limitations under the License.
  */
 
+#include <stdexcept>
 #include <string>
 #include <util/JavaModifiedUtf8.hpp>
+#include <util/string.hpp>
 
 #include <gtest/gtest.h>
 
 #include "../ByteArray.hpp"
 
 using apache::geode::client::ByteArray;
+using apache::geode::client::to_ucs4;
+using apache::geode::client::to_utf8;
 using apache::geode::client::internal::JavaModifiedUtf8;
 
 TEST(JavaModifiedUtf8Tests, EncodedLengthFromUtf8) {
@@ -51,3 +55,99 @@ TEST(JavaModifiedUtf8Tests, DecodeStringWithInlineNullChar) {
       JavaModifiedUtf8::decode(reinterpret_cast<const char*>(buf.get()), 35);
   EXPECT_EQ(expected, actual);
 }
+
+TEST(JavaModifiedUtf8Tests, DecodeToUtf8WithInlineNullChar) {
+  auto expected = std::string("You had me at");
+  expected.push_back(0);
+  expected.append(u8"meat tornad\u00F6!\U000F0000");
+
+  auto buf = ByteArray::fromString(
+      "596F7520686164206D65206174C0806D65617420746F726E6164C3B621EDAE80EDB080");
+  std::string actual;
+  JavaModifiedUtf8::decode(reinterpret_cast<const char*>(buf.get()), 35,
+                           actual);
+  EXPECT_EQ(expected, actual);
+}
+
+TEST(JavaModifiedUtf8Tests, DecodeToUcs4WithInlineNullChar) {
+  auto expected = std::u32string(U"You had me at");
+  expected.push_back(0);
+  expected.append(U"meat tornad\u00F6!\U000F0000");
+
+  auto buf = ByteArray::fromString(
+      "596F7520686164206D65206174C0806D65617420746F726E6164C3B621EDAE80EDB080");
+  std::u32string actual;
+  JavaModifiedUtf8::decode(reinterpret_cast<const char*>(buf.get()), 35,
+                           actual);
+  EXPECT_EQ(expected, actual);
+}
+
+TEST(JavaModifiedUtf8Tests, FromUtf8WithInlineNullChar) {
+  auto utf8 = std::string("You had me at");
+  utf8.push_back(0);
+  utf8.append(u8"meat tornad\u00F6!\U000F0000");
+
+  auto expected = ByteArray::fromString(
+      "596F7520686164206D65206174C0806D65617420746F726E6164C3B621EDAE80EDB080");
+  EXPECT_EQ(35, JavaModifiedUtf8::encodedLength(utf8));
+  auto actual = JavaModifiedUtf8::fromString(utf8);
+  EXPECT_EQ(std::string(reinterpret_cast<const char*>(expected.get()), 35),
+            actual);
+}
+
+TEST(JavaModifiedUtf8Tests, EncodeUcs4WithInlineNullChar) {
+  auto ucs4 = std::u32string(U"You had me at");
+  ucs4.push_back(0);
+  ucs4.append(U"meat tornad\u00F6!\U000F0000");
+
+  auto expected = ByteArray::fromString(
+      "596F7520686164206D65206174C0806D65617420746F726E6164C3B621EDAE80EDB080");
+  ASSERT_EQ(35, JavaModifiedUtf8::encodedLength(ucs4.data(), ucs4.length()));
+  std::string actual(35, '\0');
+  EXPECT_EQ(35, JavaModifiedUtf8::encode(ucs4.data(), ucs4.length(),
+                                         &actual[0], actual.length()));
+  EXPECT_EQ(std::string(reinterpret_cast<const char*>(expected.get()), 35),
+            actual);
+}
+
+TEST(JavaModifiedUtf8Tests, EncodeStopsBeforeCharacterThatDoesNotFit) {
+  const std::string utf8 = u8"ab\u00F6\U000F0000";
+  std::string jmutf8(10, '\0');
+
+  EXPECT_EQ(4, JavaModifiedUtf8::encode(utf8.data(), utf8.length(),
+                                        &jmutf8[0], 5));
+  EXPECT_EQ(std::string(u8"ab\u00F6"), jmutf8.substr(0, 4));
+  EXPECT_EQ(10, JavaModifiedUtf8::encode(utf8.data(), utf8.length(),
+                                         &jmutf8[0], 10));
+}
+
+TEST(JavaModifiedUtf8Tests, InvalidUtf8Throws) {
+  EXPECT_THROW(JavaModifiedUtf8::encodedLength("abc\x80"), std::range_error);
+  EXPECT_THROW(JavaModifiedUtf8::fromString(std::string("abc\xC3")),
+               std::range_error);
+  EXPECT_THROW(JavaModifiedUtf8::fromString(std::string("abc\xE2\x28\xA1")),
+               std::range_error);
+}
+
+TEST(JavaModifiedUtf8Tests, RoundTripsAcrossAsciiRunBoundaries) {
+  for (size_t length = 0; length < 80; ++length) {
+    for (size_t position = 0; position <= length; ++position) {
+      std::u16string utf16(length, u'x');
+      if (position < length) {
+        utf16[position] = position % 2 ? u'\u00F6' : u'\0';
+      }
+      const auto jmutf8 = JavaModifiedUtf8::fromString(utf16);
+      ASSERT_EQ(jmutf8, JavaModifiedUtf8::fromString(to_utf8(utf16)));
+
+      EXPECT_EQ(utf16, JavaModifiedUtf8::decode(jmutf8.data(), jmutf8.size()));
+
+      std::string utf8;
+      JavaModifiedUtf8::decode(jmutf8.data(), jmutf8.size(), utf8);
+      EXPECT_EQ(to_utf8(utf16), utf8);
+
+      std::u32string ucs4;
+      JavaModifiedUtf8::decode(jmutf8.data(), jmutf8.size(), ucs4);
+      EXPECT_EQ(to_ucs4(utf16), ucs4);
+    }
+  }
+}
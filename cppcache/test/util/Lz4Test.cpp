@@ -0,0 +1,108 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <util/Lz4.hpp>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using apache::geode::client::internal::Lz4;
+
+namespace {
+
+std::vector<uint8_t> compress(const std::vector<uint8_t>& source,
+                              size_t capacity) {
+  std::vector<uint8_t> compressed(capacity);
+  compressed.resize(Lz4::compress(source.data(), source.size(),
+                                  compressed.data(), compressed.size()));
+  return compressed;
+}
+
+std::vector<uint8_t> text(size_t length) {
+  const std::string sentence = "You had me at meat tornado. ";
+  std::vector<uint8_t> source;
+  while (source.size() < length) {
+    source.push_back(
+        static_cast<uint8_t>(sentence[source.size() % sentence.size()]));
+  }
+  return source;
+}
+
+}  // namespace
+
+TEST(Lz4Test, RoundTripsCompressibleData) {
+  auto source = text(10000);
+  auto compressed = compress(source, source.size());
+  ASSERT_GT(compressed.size(), 0u);
+  EXPECT_LT(compressed.size(), source.size() / 10);
+
+  std::vector<uint8_t> decompressed(source.size());
+  ASSERT_TRUE(Lz4::decompress(compressed.data(), compressed.size(),
+                              decompressed.data(), decompressed.size()));
+  EXPECT_EQ(source, decompressed);
+}
+
+TEST(Lz4Test, RoundTripsShortAndRandomData) {
+  std::mt19937 random(42);
+  for (size_t length : {1, 5, 12, 13, 100, 4097, 70000}) {
+    std::vector<uint8_t> source(length);
+    for (auto& byte : source) {
+      // a small alphabet so that some matches are found
+      byte = static_cast<uint8_t>('a' + random() % 4);
+    }
+
+    auto compressed = compress(source, length + length / 255 + 16);
+    ASSERT_GT(compressed.size(), 0u) << length;
+
+    std::vector<uint8_t> decompressed(length);
+    ASSERT_TRUE(Lz4::decompress(compressed.data(), compressed.size(),
+                                decompressed.data(), decompressed.size()))
+        << length;
+    EXPECT_EQ(source, decompressed) << length;
+  }
+}
+
+TEST(Lz4Test, ReturnsZeroIfCompressedDataDoesNotFit) {
+  std::mt19937 random(42);
+  std::vector<uint8_t> source(1000);
+  for (auto& byte : source) {
+    byte = static_cast<uint8_t>(random());
+  }
+
+  EXPECT_EQ(0u, compress(source, source.size()).size());
+}
+
+TEST(Lz4Test, RejectsMalformedBlocks) {
+  auto source = text(1000);
+  auto compressed = compress(source, source.size());
+  ASSERT_GT(compressed.size(), 0u);
+
+  std::vector<uint8_t> decompressed(source.size());
+  EXPECT_FALSE(Lz4::decompress(compressed.data(), compressed.size() - 1,
+                               decompressed.data(), decompressed.size()));
+  EXPECT_FALSE(Lz4::decompress(compressed.data(), compressed.size(),
+                               decompressed.data(), decompressed.size() - 1));
+
+  // a match reaching back before the start of the output
+  const uint8_t badOffset[] = {0x14, 'a', 0xff, 0x00, 0x50, 'b', 'c',
+                               'd',  'e', 'f'};
+  EXPECT_FALSE(Lz4::decompress(badOffset, sizeof(badOffset),
+                               decompressed.data(), 10));
+}
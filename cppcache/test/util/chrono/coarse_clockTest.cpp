@@ -0,0 +1,68 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "util/chrono/coarse_clock.hpp"
+
+using apache::geode::util::chrono::coarse_clock_ticker;
+using apache::geode::util::chrono::coarse_steady_clock;
+using apache::geode::util::chrono::coarse_system_clock;
+
+TEST(util_chrono_coarse_clockTest, steadyClockTrailsSteadyClock) {
+  coarse_clock_ticker ticker;
+  auto coarse = coarse_steady_clock::now();
+  auto now = std::chrono::steady_clock::now();
+  EXPECT_LE(coarse, now);
+  EXPECT_GT(coarse, now - std::chrono::seconds(1));
+}
+
+TEST(util_chrono_coarse_clockTest, systemClockTrailsSystemClock) {
+  coarse_clock_ticker ticker;
+  auto before = std::chrono::system_clock::now();
+  auto coarse = coarse_system_clock::now();
+  EXPECT_GT(coarse, before - std::chrono::seconds(1));
+  EXPECT_LT(coarse, before + std::chrono::seconds(1));
+}
+
+TEST(util_chrono_coarse_clockTest, advances) {
+  coarse_clock_ticker ticker;
+  auto start = coarse_steady_clock::now();
+  auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+  while (coarse_steady_clock::now() == start &&
+         std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  EXPECT_GT(coarse_steady_clock::now(), start);
+}
+
+TEST(util_chrono_coarse_clockTest, readsUnderlyingClockOnceLastTickerIsGone) {
+  {
+    coarse_clock_ticker first;
+    coarse_clock_ticker second;
+  }
+  auto before = std::chrono::steady_clock::now();
+  EXPECT_GE(coarse_steady_clock::now(), before);
+
+  // restarts after having been stopped
+  coarse_clock_ticker ticker;
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  EXPECT_LT(coarse_steady_clock::now(), std::chrono::steady_clock::now());
+}
@@ -0,0 +1,150 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "util/concurrent/sharded_shared_mutex.hpp"
+
+using apache::geode::util::concurrent::sharded_shared_mutex;
+
+namespace {
+
+// shards are per thread, so ask from a thread of its own
+bool tryLockSharedOnOtherThread(sharded_shared_mutex& mutex) {
+  return std::async(std::launch::async, [&mutex] {
+           auto locked = mutex.try_lock_shared();
+           if (locked) {
+             mutex.unlock_shared();
+           }
+           return locked;
+         })
+      .get();
+}
+
+bool tryLockOnOtherThread(sharded_shared_mutex& mutex) {
+  return std::async(std::launch::async, [&mutex] {
+           auto locked = mutex.try_lock();
+           if (locked) {
+             mutex.unlock();
+           }
+           return locked;
+         })
+      .get();
+}
+
+}  // namespace
+
+TEST(sharded_shared_mutexTest, exclusiveExcludesShared) {
+  sharded_shared_mutex mutex;
+
+  mutex.lock();
+  EXPECT_FALSE(tryLockSharedOnOtherThread(mutex));
+  EXPECT_FALSE(tryLockOnOtherThread(mutex));
+  mutex.unlock();
+
+  EXPECT_TRUE(tryLockSharedOnOtherThread(mutex));
+}
+
+TEST(sharded_shared_mutexTest, sharedExcludesExclusive) {
+  sharded_shared_mutex mutex;
+
+  mutex.lock_shared();
+  EXPECT_TRUE(tryLockSharedOnOtherThread(mutex));
+  EXPECT_FALSE(tryLockOnOtherThread(mutex));
+  mutex.unlock_shared();
+
+  EXPECT_TRUE(tryLockOnOtherThread(mutex));
+}
+
+TEST(sharded_shared_mutexTest, sharedIsRecursive) {
+  sharded_shared_mutex mutex;
+
+  mutex.lock_shared();
+  ASSERT_TRUE(mutex.try_lock_shared());
+  mutex.unlock_shared();
+  EXPECT_FALSE(tryLockOnOtherThread(mutex));
+  mutex.unlock_shared();
+
+  EXPECT_TRUE(mutex.try_lock());
+  mutex.unlock();
+}
+
+TEST(sharded_shared_mutexTest, writersSeeConsistentState) {
+  sharded_shared_mutex mutex;
+  int64_t first = 0;
+  int64_t second = 0;
+  std::atomic<bool> torn(false);
+
+  std::vector<std::thread> threads;
+  for (int thread = 0; thread < 8; ++thread) {
+    threads.emplace_back([&, thread] {
+      for (int i = 0; i < 10000; ++i) {
+        if (thread % 4 == 0) {
+          std::lock_guard<sharded_shared_mutex> lock(mutex);
+          ++first;
+          ++second;
+        } else {
+          mutex.lock_shared();
+          if (first != second) {
+            torn = true;
+          }
+          mutex.unlock_shared();
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_FALSE(torn);
+  EXPECT_EQ(20000, first);
+  EXPECT_EQ(20000, second);
+}
+
+TEST(sharded_shared_mutexTest, blockedThreadsAreWokenByUnlock) {
+  sharded_shared_mutex mutex;
+
+  // held well past the spin, so that the other threads go to sleep
+  mutex.lock_shared();
+  auto writer = std::async(std::launch::async, [&mutex] {
+    std::lock_guard<sharded_shared_mutex> lock(mutex);
+  });
+  EXPECT_EQ(std::future_status::timeout,
+            writer.wait_for(std::chrono::milliseconds(100)));
+  mutex.unlock_shared();
+  EXPECT_EQ(std::future_status::ready,
+            writer.wait_for(std::chrono::seconds(10)));
+
+  mutex.lock();
+  auto reader = std::async(std::launch::async, [&mutex] {
+    mutex.lock_shared();
+    mutex.unlock_shared();
+  });
+  EXPECT_EQ(std::future_status::timeout,
+            reader.wait_for(std::chrono::milliseconds(100)));
+  mutex.unlock();
+  EXPECT_EQ(std::future_status::ready,
+            reader.wait_for(std::chrono::seconds(10)));
+}
@@ -0,0 +1,120 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "util/concurrent/snapshot.hpp"
+
+using apache::geode::util::concurrent::snapshot;
+
+namespace {
+
+std::atomic<int> liveValues(0);
+
+struct Value {
+  Value() : number(0) { ++liveValues; }
+  Value(const Value& other) : number(other.number) { ++liveValues; }
+  ~Value() { --liveValues; }
+
+  int number;
+};
+
+}  // namespace
+
+TEST(snapshotTest, readSeesUpdates) {
+  snapshot<std::map<int, int>> map;
+
+  map.update([](std::map<int, int>& m) { m[1] = 10; });
+  map.update([](std::map<int, int>& m) { m[2] = 20; });
+
+  EXPECT_EQ(2u, map.read([](const std::map<int, int>& m) { return m.size(); }));
+  EXPECT_EQ(10, map.read([](const std::map<int, int>& m) { return m.at(1); }));
+
+  map.clear();
+  EXPECT_TRUE(map.read([](const std::map<int, int>& m) { return m.empty(); }));
+}
+
+TEST(snapshotTest, replacedValueIsFreedWhenUnread) {
+  {
+    snapshot<Value> value;
+    for (int i = 0; i < 10; ++i) {
+      value.update([i](Value& v) { v.number = i; });
+    }
+    EXPECT_EQ(1, liveValues);
+  }
+  EXPECT_EQ(0, liveValues);
+}
+
+TEST(snapshotTest, replacedValueOutlivesReader) {
+  snapshot<Value> value;
+  std::mutex mutex;
+  std::condition_variable condition;
+  bool reading = false;
+  bool updated = false;
+
+  std::thread reader([&] {
+    value.read([&](const Value& v) {
+      std::unique_lock<std::mutex> lock(mutex);
+      reading = true;
+      condition.notify_all();
+      condition.wait(lock, [&] { return updated; });
+      EXPECT_EQ(0, v.number);
+      return v.number;
+    });
+  });
+
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+    condition.wait(lock, [&] { return reading; });
+  }
+  value.update([](Value& v) { v.number = 1; });
+  EXPECT_EQ(2, liveValues);
+
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    updated = true;
+  }
+  condition.notify_all();
+  reader.join();
+
+  value.update([](Value& v) { v.number = 2; });
+  EXPECT_EQ(1, liveValues);
+  EXPECT_EQ(2, value.read([](const Value& v) { return v.number; }));
+}
+
+TEST(snapshotTest, nestedReadsAreProtected) {
+  snapshot<Value> outer;
+  snapshot<Value> inner;
+
+  auto number = outer.read([&](const Value& o) {
+    return inner.read([&](const Value& i) {
+      outer.update([](Value& v) { v.number = 1; });
+      inner.update([](Value& v) { v.number = 2; });
+      return o.number + i.number;
+    });
+  });
+
+  EXPECT_EQ(0, number);
+  EXPECT_EQ(3, outer.read([](const Value& o) { return o.number; }) +
+                   inner.read([](const Value& i) { return i.number; }));
+}
@@ -41,3 +41,41 @@ TEST(string, geode_hash) {
 
   EXPECT_EQ(701776767, hash(str));
 }
+
+TEST(u16string, geode_hash) {
+  auto&& hash = geode_hash<std::u16string>{};
+
+  EXPECT_EQ(0, hash(u""));
+  EXPECT_EQ(97, hash(u"a"));
+  EXPECT_EQ(1077910243, hash(u"supercalifragilisticexpialidocious"));
+  EXPECT_EQ(1544552287, hash(u"You had me at meat tornad\u00F6!\U000F0000"));
+}
+
+TEST(string, geode_hashMatchesSerialHashAcrossBlocks) {
+  auto&& hash = geode_hash<std::string>{};
+  auto&& hash16 = geode_hash<std::u16string>{};
+
+  for (size_t length = 0; length < 80; ++length) {
+    for (size_t position = 0; position <= length; ++position) {
+      std::string str;
+      std::u16string str16;
+      for (size_t i = 0; i < length; ++i) {
+        if (i == position) {
+          str.append(u8"\u00F6");
+          str16.push_back(u'\u00F6');
+        } else {
+          str.push_back(static_cast<char>('A' + i % 26));
+          str16.push_back(static_cast<char16_t>('A' + i % 26));
+        }
+      }
+
+      int32_t expected = 0;
+      for (auto c : str16) {
+        expected = static_cast<int32_t>(31 * static_cast<uint32_t>(expected) +
+                                        static_cast<uint32_t>(c));
+      }
+      EXPECT_EQ(expected, hash(str));
+      EXPECT_EQ(expected, hash16(str16));
+    }
+  }
+}